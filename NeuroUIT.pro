@@ -15,8 +15,25 @@ HEADERS += \
     include/core/Layer.h \
     include/core/Network.h \
     include/core/ActivationFunction.h \
+    include/core/ActivationKernels.h \
+    include/core/AlignedAllocator.h \
+    include/core/Kernels.h \
+    include/core/LinearAlgebra.h \
+    include/core/Matrix.h \
+    include/core/Precision.h \
+    include/core/Span.h \
+    include/core/Workspace.h \
+    include/core/Gradients.h \
     include/dataset/DatasetManager.h \
+    include/dataset/DatasetView.h \
+    include/dataset/MappedFile.h \
+    include/dataset/StreamingDataset.h \
     include/training/Trainer.h \
+    include/training/BatchPrefetcher.h \
+    include/training/Evaluator.h \
+    include/training/DataParallel.h \
+    include/concurrency/SpscQueue.h \
+    include/concurrency/ThreadPool.h \
     include/persistence/Persistence.h \
     include/ui/MainWindow.h \
     include/ui/NetworkConfigDialog.h \
@@ -30,6 +47,7 @@ HEADERS += \
     include/ui/PredictionsChartWidget.h \
     include/ui/StatisticsWidget.h \
     include/ui/ResultsDashboardWidget.h \
+    include/ui/TestResultsTableModel.h \
     include/controller/Controller.h
 
 # Sources
@@ -38,9 +56,19 @@ SOURCES += \
     src/core/Neuron.cpp \
     src/core/Layer.cpp \
     src/core/Network.cpp \
+    src/core/Workspace.cpp \
     src/core/ActivationFunction.cpp \
+    src/core/ActivationKernels.cpp \
+    src/core/Kernels.cpp \
+    src/core/LinearAlgebra.cpp \
     src/dataset/DatasetManager.cpp \
+    src/dataset/MappedFile.cpp \
+    src/dataset/StreamingDataset.cpp \
     src/training/Trainer.cpp \
+    src/training/BatchPrefetcher.cpp \
+    src/training/Evaluator.cpp \
+    src/training/DataParallel.cpp \
+    src/concurrency/ThreadPool.cpp \
     src/persistence/Persistence.cpp \
     src/ui/MainWindow.cpp \
     src/ui/MainWindow_helpers.cpp \
@@ -55,6 +83,7 @@ SOURCES += \
     src/ui/PredictionsChartWidget.cpp \
     src/ui/StatisticsWidget.cpp \
     src/ui/ResultsDashboardWidget.cpp \
+    src/ui/TestResultsTableModel.cpp \
     src/controller/Controller.cpp
 
 # Output directory
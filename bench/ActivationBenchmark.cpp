@@ -0,0 +1,130 @@
+#include "Benchmark.h"
+#include "core/ActivationFunction.h"
+#include "core/Kernels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace NeuroUIT {
+namespace Bench {
+
+namespace {
+
+constexpr size_t DEFAULT_COUNT = 2000000;
+constexpr size_t REPETITIONS = 5;
+constexpr double RANGE = 30.0;     // Arguments tirés uniformément dans [-RANGE, RANGE]
+
+/**
+ * @brief Mesure une fonction d'activation : exacte (ActivationFunction) contre approchée (Kernels)
+ */
+template <typename T, typename Approximate>
+void measure(const char* name, const ActivationFunction& exact, const Approximate& approximate,
+             const std::vector<double>& arguments) {
+    size_t n = arguments.size();
+    std::vector<T> x(arguments.begin(), arguments.end());
+    std::vector<T> exactValues(n);
+    std::vector<T> approximateValues(n);
+
+    double exactTime = bestTime(REPETITIONS, [&] {
+        for (size_t i = 0; i < n; ++i) {
+            exactValues[i] = static_cast<T>(exact.activate(static_cast<double>(x[i])));
+        }
+    });
+    double approximateTime = bestTime(REPETITIONS, [&] {
+        approximate(x.data(), approximateValues.data(), n);
+    });
+
+    // Erreur par rapport à la valeur exacte en double, pour le même argument
+    double maxError = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double reference = exact.activate(static_cast<double>(x[i]));
+        maxError = std::max(maxError, std::abs(static_cast<double>(approximateValues[i]) - reference));
+    }
+
+    std::printf("  %-8s %-6s %10.1f %10.1f %8.2fx %12.2e\n", name,
+                sizeof(T) == sizeof(float) ? "float" : "double",
+                n / exactTime * 1e-6, n / approximateTime * 1e-6,
+                exactTime / approximateTime, maxError);
+}
+
+/**
+ * @brief Mesure exp scalaire : std::exp contre Kernels::fastExp (erreur relative)
+ */
+template <typename T>
+void measureExp(const std::vector<double>& arguments) {
+    size_t n = arguments.size();
+    std::vector<T> x(arguments.begin(), arguments.end());
+    std::vector<T> exactValues(n);
+    std::vector<T> approximateValues(n);
+
+    double exactTime = bestTime(REPETITIONS, [&] {
+        for (size_t i = 0; i < n; ++i) {
+            exactValues[i] = std::exp(x[i]);
+        }
+    });
+    double approximateTime = bestTime(REPETITIONS, [&] {
+        for (size_t i = 0; i < n; ++i) {
+            approximateValues[i] = Kernels::fastExp(x[i]);
+        }
+    });
+
+    double maxError = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double reference = std::exp(static_cast<double>(x[i]));
+        maxError = std::max(maxError, std::abs(approximateValues[i] - reference) / reference);
+    }
+
+    std::printf("  %-8s %-6s %10.1f %10.1f %8.2fx %12.2e (relative)\n", "exp",
+                sizeof(T) == sizeof(float) ? "float" : "double",
+                n / exactTime * 1e-6, n / approximateTime * 1e-6,
+                exactTime / approximateTime, maxError);
+}
+
+} // namespace
+
+int runActivationBenchmark(int argc, char** argv) {
+    size_t n = argc > 0 ? std::strtoull(argv[0], nullptr, 10) : DEFAULT_COUNT;
+    if (n == 0) {
+        std::fprintf(stderr, "Usage : activations [nombre d'éléments]\n");
+        return 1;
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-RANGE, RANGE);
+    std::vector<double> arguments(n);
+    for (auto& argument : arguments) {
+        argument = distribution(generator);
+    }
+
+    SigmoidFunction sigmoid;
+    TanhFunction tanh;
+    auto fastSigmoid = [](const auto* x, auto* y, size_t count) { Kernels::fastSigmoid(x, y, count); };
+    auto fastTanh = [](const auto* x, auto* y, size_t count) { Kernels::fastTanh(x, y, count); };
+
+    std::printf("%zu arguments dans [-%g, %g], meilleur de %zu exécutions\n", n, RANGE, RANGE, REPETITIONS);
+    std::printf("Débits en millions d'éléments/s ; erreur absolue maximale sauf mention\n");
+
+    SimdLevel best = Kernels::getLevel();
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level > best) {
+            break;
+        }
+        Kernels::setLevel(level);
+        std::printf("\n[%s]\n  %-8s %-6s %10s %10s %9s %12s\n", Kernels::levelName(level).c_str(),
+                    "fonction", "type", "exacte", "approchée", "gain", "erreur max");
+        measure<double>("sigmoid", sigmoid, fastSigmoid, arguments);
+        measure<float>("sigmoid", sigmoid, fastSigmoid, arguments);
+        measure<double>("tanh", tanh, fastTanh, arguments);
+        measure<float>("tanh", tanh, fastTanh, arguments);
+        measureExp<double>(arguments);
+        measureExp<float>(arguments);
+    }
+    Kernels::setLevel(best);
+    return 0;
+}
+
+} // namespace Bench
+} // namespace NeuroUIT
@@ -0,0 +1,62 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace NeuroUIT {
+namespace Bench {
+
+/**
+ * @brief Meilleur temps (en secondes) de repetitions exécutions de function
+ * Le minimum écarte les interruptions du système ; la première exécution
+ * chauffe les caches
+ */
+template <typename Function>
+double bestTime(size_t repetitions, const Function& function) {
+    double best = std::numeric_limits<double>::infinity();
+    for (size_t r = 0; r < repetitions; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (seconds < best) {
+            best = seconds;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Nombres de threads mesurés : 1, 2, 4... jusqu'au nombre de cœurs (inclus)
+ */
+std::vector<size_t> threadCounts();
+
+/**
+ * @brief Écrit un CSV synthétique de la forme de data/binary_large_dataset.csv
+ * En-tête x1..x5,output ; cinq entrées dans [0, 1], sortie 1 si leur somme dépasse 2.5
+ * @return Taille du fichier en octets (0 en cas d'erreur)
+ */
+size_t writeSyntheticCSV(const std::string& filename, size_t numRows);
+
+/**
+ * @brief Précision et débit des activations approchées face à SigmoidFunction/TanhFunction
+ */
+int runActivationBenchmark(int argc, char** argv);
+
+/**
+ * @brief Débit du chargement CSV (Mo/s) selon le nombre de threads
+ */
+int runCSVBenchmark(int argc, char** argv);
+
+/**
+ * @brief Débit d'entraînement (échantillons/s) de 1 à N threads, modes synchrone et Hogwild
+ */
+int runScalingBenchmark(int argc, char** argv);
+
+} // namespace Bench
+} // namespace NeuroUIT
+
+#endif // BENCHMARK_H
@@ -0,0 +1,68 @@
+#include "Benchmark.h"
+#include "dataset/DatasetManager.h"
+#include "concurrency/ThreadPool.h"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+namespace NeuroUIT {
+namespace Bench {
+
+namespace {
+
+constexpr size_t DEFAULT_ROWS = 2000000;
+constexpr size_t REPETITIONS = 3;
+
+} // namespace
+
+int runCSVBenchmark(int argc, char** argv) {
+    size_t numRows = argc > 0 ? std::strtoull(argv[0], nullptr, 10) : DEFAULT_ROWS;
+    if (numRows == 0) {
+        std::fprintf(stderr, "Usage : csv [nombre de lignes]\n");
+        return 1;
+    }
+
+    std::string filename = (std::filesystem::temp_directory_path() / "neurouit_bench.csv").string();
+    size_t fileSize = writeSyntheticCSV(filename, numRows);
+    if (fileSize == 0) {
+        std::fprintf(stderr, "Impossible d'écrire %s\n", filename.c_str());
+        return 1;
+    }
+
+    std::printf("%zu lignes, %.1f Mo (%s), meilleur de %zu chargements\n",
+                numRows, fileSize / 1e6, filename.c_str(), REPETITIONS);
+    std::printf("  %-8s %10s %10s %9s\n", "threads", "temps (s)", "Mo/s", "gain");
+
+    int status = 0;
+    double singleThreadTime = 0.0;
+    for (size_t numThreads : threadCounts()) {
+        // Le thread appelant compte parmi les threads d'analyse
+        ThreadPool::Options options;
+        options.numThreads = numThreads - 1;
+        ThreadPool pool(options);
+
+        DatasetManager dataset;
+        dataset.setThreadPool(&pool);
+        bool loaded = true;
+        double seconds = bestTime(REPETITIONS, [&] {
+            loaded = loaded && dataset.loadFromCSV(filename, 5, 1, true, numThreads);
+        });
+        if (!loaded || dataset.getNumSamples() != numRows) {
+            std::fprintf(stderr, "Chargement incorrect avec %zu threads\n", numThreads);
+            status = 1;
+            break;
+        }
+
+        if (numThreads == 1) {
+            singleThreadTime = seconds;
+        }
+        std::printf("  %-8zu %10.3f %10.1f %8.2fx\n", numThreads, seconds,
+                    fileSize / seconds / 1e6, singleThreadTime / seconds);
+    }
+
+    std::filesystem::remove(filename);
+    return status;
+}
+
+} // namespace Bench
+} // namespace NeuroUIT
@@ -0,0 +1,110 @@
+#include "Benchmark.h"
+#include "concurrency/ThreadPool.h"
+#include "dataset/DatasetManager.h"
+#include "dataset/DatasetView.h"
+#include "training/Trainer.h"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <numeric>
+
+namespace NeuroUIT {
+namespace Bench {
+
+namespace {
+
+constexpr size_t DEFAULT_ROWS = 2000000;
+constexpr size_t DEFAULT_EPOCHS = 1;
+constexpr size_t BATCH_SIZE = 256;
+constexpr unsigned int SEED = 42;
+
+/**
+ * @brief Entraîne un réseau neuf (mêmes poids initiaux) et renvoie ses résultats
+ */
+TrainingResults trainOnce(const DatasetView& trainSet, ThreadPool& pool,
+                          size_t numThreads, ParallelMode mode, size_t numEpochs) {
+    auto network = std::make_shared<Network>(
+        std::vector<size_t>{5, 64, 32, 1},
+        std::vector<ActivationType>{ActivationType::ReLU, ActivationType::Tanh, ActivationType::Sigmoid});
+    network->initializeWeights(SEED);
+
+    Trainer trainer(network);
+    trainer.setThreadPool(&pool);
+
+    // Sans momentum ni préchargement : seul le calcul réparti est mesuré,
+    // dans les mêmes conditions pour les deux modes
+    TrainingParams params;
+    params.learningRate = 0.1;
+    params.numEpochs = numEpochs;
+    params.batchSize = BATCH_SIZE;
+    params.shuffle = false;
+    params.prefetchDepth = 0;
+    params.numThreads = numThreads;
+    params.parallelMode = mode;
+    return trainer.train(trainSet, params);
+}
+
+} // namespace
+
+int runScalingBenchmark(int argc, char** argv) {
+    size_t numRows = argc > 0 ? std::strtoull(argv[0], nullptr, 10) : DEFAULT_ROWS;
+    size_t numEpochs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_EPOCHS;
+    if (numRows == 0 || numEpochs == 0) {
+        std::fprintf(stderr, "Usage : scaling [nombre de lignes] [époques]\n");
+        return 1;
+    }
+
+    std::string filename = (std::filesystem::temp_directory_path() / "neurouit_scaling.csv").string();
+    if (writeSyntheticCSV(filename, numRows) == 0) {
+        std::fprintf(stderr, "Impossible d'écrire %s\n", filename.c_str());
+        return 1;
+    }
+
+    DatasetManager dataset;
+    bool loaded = dataset.loadFromCSV(filename, 5, 1, true, 1);
+    std::filesystem::remove(filename);
+    if (!loaded || dataset.getNumSamples() != numRows) {
+        std::fprintf(stderr, "Chargement du dataset synthétique impossible\n");
+        return 1;
+    }
+
+    std::vector<uint32_t> indices(numRows);
+    std::iota(indices.begin(), indices.end(), 0u);
+    DatasetView trainSet(dataset, std::move(indices));
+
+    std::printf("%zu échantillons (5 entrées, 1 sortie), réseau 5-64-32-1, lots de %zu, %zu époque(s)\n",
+                numRows, BATCH_SIZE, numEpochs);
+
+    const struct {
+        ParallelMode mode;
+        const char* name;
+    } modes[] = {{ParallelMode::Synchronous, "synchrone"}, {ParallelMode::Hogwild, "hogwild"}};
+
+    for (const auto& mode : modes) {
+        std::printf("\n[%s]\n  %-8s %10s %14s %9s %14s\n", mode.name,
+                    "threads", "temps (s)", "échantillons/s", "gain", "erreur finale");
+        double singleThreadRate = 0.0;
+        for (size_t numThreads : threadCounts()) {
+            // Le thread appelant compte parmi les threads de calcul
+            ThreadPool::Options options;
+            options.numThreads = numThreads - 1;
+            ThreadPool pool(options);
+
+            auto start = std::chrono::steady_clock::now();
+            TrainingResults results = trainOnce(trainSet, pool, numThreads, mode.mode, numEpochs);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            if (numThreads == 1) {
+                singleThreadRate = results.samplesPerSecond;
+            }
+            std::printf("  %-8zu %10.3f %14.0f %8.2fx %14.6f\n", numThreads, seconds,
+                        results.samplesPerSecond, results.samplesPerSecond / singleThreadRate,
+                        results.finalError);
+        }
+    }
+    return 0;
+}
+
+} // namespace Bench
+} // namespace NeuroUIT
@@ -0,0 +1,45 @@
+#include "Benchmark.h"
+#include <cstdio>
+#include <random>
+#include <thread>
+
+namespace NeuroUIT {
+namespace Bench {
+
+std::vector<size_t> threadCounts() {
+    size_t numCores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<size_t> counts;
+    for (size_t count = 1; count < numCores; count *= 2) {
+        counts.push_back(count);
+    }
+    counts.push_back(numCores);
+    return counts;
+}
+
+size_t writeSyntheticCSV(const std::string& filename, size_t numRows) {
+    std::FILE* file = std::fopen(filename.c_str(), "wb");
+    if (!file) {
+        return 0;
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::fputs("x1,x2,x3,x4,x5,output\n", file);
+    for (size_t row = 0; row < numRows; ++row) {
+        double values[5];
+        double sum = 0.0;
+        for (double& value : values) {
+            value = distribution(generator);
+            sum += value;
+        }
+        std::fprintf(file, "%.6f,%.6f,%.6f,%.6f,%.6f,%d\n",
+                     values[0], values[1], values[2], values[3], values[4], sum > 2.5 ? 1 : 0);
+    }
+
+    long size = std::ftell(file);
+    bool ok = std::fclose(file) == 0 && size > 0;
+    return ok ? static_cast<size_t>(size) : 0;
+}
+
+} // namespace Bench
+} // namespace NeuroUIT
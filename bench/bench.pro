@@ -0,0 +1,42 @@
+# Benchmarks de performance (console, sans Qt)
+# Compilation : qmake bench/bench.pro && make ; exécution : bin/NeuroUIT_bench --help
+
+QT =
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+
+TARGET = NeuroUIT_bench
+TEMPLATE = app
+
+INCLUDEPATH += $$PWD/../include
+INCLUDEPATH += $$PWD
+
+unix: LIBS += -lpthread
+
+HEADERS += \
+    Benchmark.h
+
+SOURCES += \
+    main.cpp \
+    SyntheticData.cpp \
+    ActivationBenchmark.cpp \
+    CSVBenchmark.cpp \
+    ScalingBenchmark.cpp \
+    ../src/core/Neuron.cpp \
+    ../src/core/Layer.cpp \
+    ../src/core/Network.cpp \
+    ../src/core/Workspace.cpp \
+    ../src/core/ActivationFunction.cpp \
+    ../src/core/ActivationKernels.cpp \
+    ../src/core/Kernels.cpp \
+    ../src/core/LinearAlgebra.cpp \
+    ../src/dataset/DatasetManager.cpp \
+    ../src/dataset/MappedFile.cpp \
+    ../src/dataset/StreamingDataset.cpp \
+    ../src/training/Trainer.cpp \
+    ../src/training/DataParallel.cpp \
+    ../src/training/BatchPrefetcher.cpp \
+    ../src/concurrency/ThreadPool.cpp
+
+DESTDIR = $$PWD/../bin
+OBJECTS_DIR = $$PWD/../build/bench/obj
@@ -0,0 +1,47 @@
+#include "Benchmark.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+struct BenchmarkEntry {
+    const char* name;
+    const char* description;
+    int (*run)(int argc, char** argv);
+};
+
+const BenchmarkEntry BENCHMARKS[] = {
+    {"activations", "précision et débit des activations approchées (exp, sigmoïde, tanh)",
+     NeuroUIT::Bench::runActivationBenchmark},
+    {"csv", "débit du chargement CSV (Mo/s) selon le nombre de threads",
+     NeuroUIT::Bench::runCSVBenchmark},
+    {"scaling", "débit d'entraînement (échantillons/s) selon le nombre de threads",
+     NeuroUIT::Bench::runScalingBenchmark},
+};
+
+void printUsage(const char* program) {
+    std::printf("Usage : %s <benchmark> [options]\n\n", program);
+    for (const auto& entry : BENCHMARKS) {
+        std::printf("  %-12s %s\n", entry.name, entry.description);
+    }
+    std::printf("\nNEUROUIT_SIMD (scalar, sse2, avx2, avx512) limite le jeu d'instructions.\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2 || std::strcmp(argv[1], "--help") == 0) {
+        printUsage(argv[0]);
+        return argc < 2 ? 1 : 0;
+    }
+
+    for (const auto& entry : BENCHMARKS) {
+        if (std::strcmp(argv[1], entry.name) == 0) {
+            return entry.run(argc - 2, argv + 2);
+        }
+    }
+
+    std::fprintf(stderr, "Benchmark inconnu : %s\n\n", argv[1]);
+    printUsage(argv[0]);
+    return 1;
+}
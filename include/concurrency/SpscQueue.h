@@ -0,0 +1,104 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include "core/AlignedAllocator.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief File bornée sans verrou à un producteur et un consommateur
+ *
+ * Tampon circulaire dont la capacité est arrondie à une puissance de deux.
+ * tryPush ne doit être appelé que par un seul thread (le producteur) et
+ * tryPop que par un seul autre (le consommateur). Les indices de lecture et
+ * d'écriture sont sur des lignes de cache distinctes, et chaque côté garde
+ * une copie locale de l'indice de l'autre pour limiter les échanges entre cœurs.
+ *
+ * @tparam T Type des éléments (de préférence petit : indice, pointeur...)
+ */
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity)
+        : buffer_(roundUpToPowerOfTwo(capacity))
+        , mask_(buffer_.size() - 1)
+        , head_(0)
+        , cachedTail_(0)
+        , tail_(0)
+        , cachedHead_(0)
+    {
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Ajoute un élément (côté producteur)
+     * @return False si la file est pleine
+     */
+    bool tryPush(const T& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ == buffer_.size()) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ == buffer_.size()) {
+                return false;
+            }
+        }
+        buffer_[tail & mask_] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Retire un élément (côté consommateur)
+     * @return False si la file est vide
+     */
+    bool tryPop(T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_) {
+                return false;
+            }
+        }
+        value = buffer_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Nombre d'éléments (approximatif si l'autre côté est actif)
+     */
+    size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const { return buffer_.size(); }
+
+private:
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    std::vector<T> buffer_;
+    const size_t mask_;
+
+    // Côté consommateur
+    alignas(kCacheLineSize) std::atomic<size_t> head_;  // Prochain élément à lire
+    size_t cachedTail_;                                 // Dernier tail_ observé
+
+    // Côté producteur
+    alignas(kCacheLineSize) std::atomic<size_t> tail_;  // Prochaine case à écrire
+    size_t cachedHead_;                                 // Dernier head_ observé
+};
+
+} // namespace NeuroUIT
+
+#endif // SPSCQUEUE_H
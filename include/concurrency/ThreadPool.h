@@ -0,0 +1,249 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "core/AlignedAllocator.h"
+
+namespace NeuroUIT {
+
+class TaskGroup;
+
+/**
+ * @brief Ordonnanceur de tâches à vol de travail
+ *
+ * Chaque thread de travail possède sa file de tâches : il empile et dépile
+ * ses propres tâches par la fin (les plus récentes, encore en cache) et, sa
+ * file vide, vole les plus anciennes par le début de la file d'un autre. Les
+ * tâches soumises depuis un thread extérieur (GUI, thread d'entraînement)
+ * passent par une file d'injection commune. Les threads sans travail dorment.
+ *
+ * Un thread qui attend un TaskGroup exécute lui-même les tâches en attente :
+ * l'appelant participe au calcul, et attendre depuis une tâche (parallélisme
+ * imbriqué) ne bloque pas un thread du pool.
+ *
+ * Réservé au calcul : les attentes longues (entrées/sorties, pause) doivent
+ * rester sur des threads dédiés pour ne pas immobiliser un thread du pool.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Configuration du pool
+     */
+    struct Options {
+        size_t numThreads = 0;       // Threads de travail (0 = nombre de cœurs - 1,
+                                     // le thread appelant complétant les calculs)
+        bool pinThreads = false;     // Fixe le thread i sur le cœur i (Linux uniquement)
+    };
+
+    /**
+     * @brief Compteurs d'activité d'un thread de travail
+     */
+    struct WorkerStats {
+        uint64_t tasksExecuted = 0;  // Tâches exécutées (volées comprises)
+        uint64_t tasksStolen = 0;    // Tâches prises dans la file d'un autre thread
+        double busySeconds = 0.0;    // Temps passé à exécuter des tâches
+        double idleSeconds = 0.0;    // Temps passé endormi, sans tâche
+    };
+
+    using Task = std::function<void()>;
+
+    ThreadPool() : ThreadPool(Options()) {}
+
+    /**
+     * @brief Lance les threads de travail
+     */
+    explicit ThreadPool(const Options& options);
+
+    /**
+     * @brief Exécute les tâches restantes puis arrête les threads
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Nombre de threads de travail
+     */
+    size_t getNumThreads() const { return workers_.size(); }
+
+    /**
+     * @brief Parallélisme d'un appel parallelFor (threads du pool + appelant)
+     */
+    size_t getConcurrency() const { return workers_.size() + 1; }
+
+    const Options& getOptions() const { return options_; }
+
+    /**
+     * @brief Compteurs de chaque thread de travail
+     */
+    std::vector<WorkerStats> getStats() const;
+
+    /**
+     * @brief Remet les compteurs à zéro
+     */
+    void resetStats();
+
+    /**
+     * @brief Exécute body(chunkBegin, chunkEnd) sur des intervalles disjoints couvrant [begin, end)
+     *
+     * L'intervalle est découpé en au plus CHUNKS_PER_THREAD morceaux par
+     * thread (pour que le vol de travail équilibre des morceaux inégaux), d'au
+     * moins grain éléments chacun. Le premier morceau est traité par l'appelant.
+     *
+     * @throws La première exception levée par body
+     */
+    template <typename Function>
+    void parallelFor(size_t begin, size_t end, size_t grain, const Function& body);
+
+    /**
+     * @brief Morceaux par thread dans parallelFor
+     */
+    static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+private:
+    friend class TaskGroup;
+
+    /**
+     * @brief Tâche en file, rattachée au groupe qui l'attend
+     */
+    struct Job {
+        Task task;
+        TaskGroup* group = nullptr;
+    };
+
+    /**
+     * @brief État d'un thread de travail (une ligne de cache par thread pour les compteurs)
+     */
+    struct alignas(kCacheLineSize) Worker {
+        std::mutex mutex;                      // Protège tasks
+        std::deque<Job> tasks;                 // Fin : propriétaire ; début : voleurs
+        std::atomic<uint64_t> tasksExecuted{0};
+        std::atomic<uint64_t> tasksStolen{0};
+        std::atomic<uint64_t> busyNanoseconds{0};
+        std::atomic<uint64_t> idleNanoseconds{0};
+        std::thread thread;
+    };
+
+    Options options_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::mutex injectionMutex_;
+    std::deque<Job> injected_;                 // Tâches soumises hors du pool
+
+    std::mutex sleepMutex_;
+    std::condition_variable wakeCondition_;
+    std::atomic<size_t> queuedTasks_;          // Tâches en file, toutes files confondues
+    bool stopping_;                            // Protégé par sleepMutex_
+
+    /**
+     * @brief Met une tâche en file (file du thread courant s'il appartient au pool)
+     */
+    void submit(Job job);
+
+    /**
+     * @brief Exécute une tâche en attente, depuis n'importe quel thread
+     * @return False si aucune tâche n'était disponible
+     */
+    bool tryRunPendingTask();
+
+    /**
+     * @brief Prend une tâche : sa propre file, puis l'injection, puis le vol
+     * @param self Indice du thread appelant dans le pool (ou getNumThreads())
+     * @param stolen Reçoit true si la tâche vient de la file d'un autre thread
+     */
+    bool popTask(size_t self, Job& job, bool& stolen);
+
+    void execute(Job& job);
+    void workerLoop(size_t index);
+
+    /**
+     * @brief Indice du thread courant dans ce pool (getNumThreads() si extérieur)
+     */
+    size_t currentWorker() const;
+};
+
+/**
+ * @brief Ensemble de tâches dont on attend la fin
+ *
+ * Le groupe doit survivre à ses tâches : le destructeur attend celles qui
+ * restent. Les tâches peuvent elles-mêmes créer des groupes.
+ */
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool) : pool_(pool), pending_(0) {}
+
+    /**
+     * @brief Attend les tâches restantes (sans relancer leurs exceptions)
+     */
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * @brief Soumet une tâche au pool
+     */
+    void run(ThreadPool::Task task);
+
+    /**
+     * @brief Exécute des tâches en attente jusqu'à la fin de celles du groupe
+     * @throws La première exception levée par une tâche du groupe
+     */
+    void wait();
+
+private:
+    friend class ThreadPool;
+
+    /**
+     * @brief Fin d'une tâche du groupe (appelé par le thread qui l'a exécutée)
+     */
+    void finish(std::exception_ptr error);
+
+    ThreadPool& pool_;
+    std::mutex mutex_;                      // Protège pending_ et error_
+    std::condition_variable doneCondition_;
+    size_t pending_;                        // Tâches soumises non terminées
+    std::exception_ptr error_;              // Première exception d'une tâche
+};
+
+template <typename Function>
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t grain, const Function& body) {
+    if (begin >= end) {
+        return;
+    }
+
+    size_t count = end - begin;
+    grain = std::max<size_t>(grain, 1);
+    size_t numChunks = std::min((count + grain - 1) / grain, getConcurrency() * CHUNKS_PER_THREAD);
+    if (numChunks <= 1) {
+        body(begin, end);
+        return;
+    }
+
+    auto chunkStart = [&](size_t c) { return begin + c * count / numChunks; };
+
+    // En cas d'exception de l'appelant, le destructeur attend les autres morceaux
+    TaskGroup group(*this);
+    for (size_t c = 1; c < numChunks; ++c) {
+        size_t chunkBegin = chunkStart(c);
+        size_t chunkEnd = chunkStart(c + 1);
+        group.run([&body, chunkBegin, chunkEnd] { body(chunkBegin, chunkEnd); });
+    }
+    body(begin, chunkStart(1));
+    group.wait();
+}
+
+} // namespace NeuroUIT
+
+#endif // THREADPOOL_H
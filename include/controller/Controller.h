@@ -1,20 +1,40 @@
 #ifndef CONTROLLER_H
 #define CONTROLLER_H
 
+#include <atomic>
+#include <cstdint>
+#include <exception>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 #include <QObject>
+#include <QString>
 #include "core/Network.h"
 #include "core/ActivationFunction.h"
 #include "dataset/DatasetManager.h"
+#include "dataset/DatasetView.h"
 #include "training/Trainer.h"
+#include "training/Evaluator.h"
 #include "persistence/Persistence.h"
+#include "concurrency/SpscQueue.h"
+#include "concurrency/ThreadPool.h"
+
+class QTimer;
 
 namespace NeuroUIT {
 
 /**
  * @brief Contrôleur MVC - coordonne UI et logique métier
+ *
+ * L'entraînement s'exécute sur un thread dédié. Sa progression transite par
+ * une SpscQueue que le thread GUI vide à sa propre cadence (QTimer) : le
+ * thread d'entraînement n'attend jamais l'interface. Pendant l'entraînement,
+ * le réseau et le dataset appartiennent au thread d'entraînement et les
+ * opérations qui les lisent ou les remplacent sont refusées.
+ *
+ * Le Controller possède le pool de threads de calcul partagé par le
+ * chargement CSV, l'entraînement parallèle et l'évaluation.
  */
 class Controller : public QObject {
     Q_OBJECT
@@ -47,29 +67,86 @@ public:
     bool saveNetwork(const std::string& filename);
     
     /**
-     * @brief Charge un dataset CSV
+     * @brief Charge un dataset CSV ou binaire (.nuid)
+     *
+     * Un fichier .nuid est projeté en mémoire et impose ses propres dimensions.
+     * Avec useCache, un CSV est converti une seule fois en cache binaire,
+     * rangé dans le dossier de cache de l'application (getDatasetCacheDirectory)
+     * sous une clé dérivée du chemin, de la date de modification et de la taille
+     * du CSV ; les chargements suivants ouvrent ce cache tant que le CSV n'a
+     * pas changé et que la configuration est identique. Rien n'est écrit à
+     * côté du fichier de l'utilisateur.
+     *
      * @param filename Nom du fichier
-     * @param numInputs Nombre d'entrées
-     * @param numOutputs Nombre de sorties
-     * @param hasHeader True si le fichier a des en-têtes
+     * @param numInputs Nombre d'entrées (CSV uniquement)
+     * @param numOutputs Nombre de sorties (CSV uniquement)
+     * @param hasHeader True si le fichier a des en-têtes (CSV uniquement)
+     * @param useCache Utiliser et créer le cache binaire (CSV uniquement)
      * @return True si chargé avec succès
      */
     bool loadDataset(const std::string& filename,
                     size_t numInputs,
                     size_t numOutputs,
-                    bool hasHeader);
+                    bool hasHeader,
+                    bool useCache = true);
+    
+    /**
+     * @brief Dossier des caches binaires de CSV (vide si indisponible)
+     */
+    static std::string getDatasetCacheDirectory();
+    
+    /**
+     * @brief Supprime tous les caches binaires de CSV
+     * Le dataset chargé reste utilisable (projection déjà ouverte)
+     * @return Nombre de fichiers supprimés
+     */
+    size_t clearDatasetCache();
+    
+    /**
+     * @brief Modifie le découpage train/validation/test
+     * Le dataset déjà chargé est redécoupé immédiatement
+     * @param options Proportions, graine et stratification
+     */
+    void setSplitOptions(const DatasetManager::SplitOptions& options);
     
     /**
-     * @brief Lance l'entraînement
+     * @brief Obtient les options de découpage actuelles
+     */
+    const DatasetManager::SplitOptions& getSplitOptions() const { return splitOptions_; }
+    
+    /**
+     * @brief Lance l'entraînement sur le thread d'entraînement
+     * Retourne immédiatement ; trainingFinished() est émis à la fin
      * @param params Paramètres d'entraînement
+     * @return False si aucun réseau/dataset ou si un entraînement est en cours
      */
-    void startTraining(const Trainer::TrainingParams& params);
+    bool startTraining(const Trainer::TrainingParams& params);
     
     /**
-     * @brief Arrête l'entraînement
+     * @brief Arrête l'entraînement (à la fin du lot courant)
      */
     void stopTraining();
     
+    /**
+     * @brief Suspend l'entraînement à la fin du lot courant
+     */
+    void pauseTraining();
+    
+    /**
+     * @brief Reprend un entraînement suspendu
+     */
+    void resumeTraining();
+    
+    /**
+     * @brief Vérifie si un entraînement est en cours (ou pas encore finalisé)
+     */
+    bool isTraining() const { return trainingThread_.joinable(); }
+    
+    /**
+     * @brief Vérifie si l'entraînement est suspendu
+     */
+    bool isTrainingPaused() const { return trainer_ && trainer_->isPaused(); }
+    
     /**
      * @brief Teste le réseau sur les données de test
      * @return Erreur moyenne
@@ -94,50 +171,77 @@ public:
     DatasetManager::Statistics getDatasetStatistics() const;
     
     /**
-     * @brief Structure pour les résultats de test complets
-     */
-    struct TestResults {
-        std::vector<double> predictions;           // Prédictions
-        std::vector<double> actuals;                // Valeurs réelles
-        std::vector<std::vector<int>> confusionMatrix; // Matrice de confusion
-        double mse = 0.0;                          // Erreur quadratique moyenne
-        double mae = 0.0;                          // Erreur absolue moyenne
-        double r2 = 0.0;                           // Coefficient R²
-        double accuracy = 0.0;                     // Précision (classification)
-        double precision = 0.0;                    // Précision (classification)
-        double recall = 0.0;                        // Rappel (classification)
-        double f1Score = 0.0;                      // Score F1
-        bool isClassification = true;              // Type de problème
-    };
+     * @brief Résultats de test complets (voir Evaluator)
+     */
+    using TestResults = EvaluationResults;
     
     /**
      * @brief Teste le réseau et retourne des résultats détaillés
+     *
+     * Le résultat est mémorisé jusqu'à la prochaine modification des poids
+     * (Network::getVersion()), au remplacement du réseau ou au redécoupage du
+     * dataset : les appels répétés (métriques, tableau de résultats...) ne
+     * refont pas l'évaluation.
+     *
+     * @return Référence valable jusqu'au prochain appel
      */
-    TestResults getDetailedTestResults();
+    const TestResults& getDetailedTestResults();
     
     /**
      * @brief Calcule la matrice de corrélation du dataset
+     * Mémorisée jusqu'au prochain chargement ou découpage du dataset
      */
-    std::vector<std::vector<double>> getCorrelationMatrix() const;
+    const std::vector<std::vector<double>>& getCorrelationMatrix() const;
     
     /**
      * @brief Obtient les erreurs d'entraînement
      */
     const std::vector<double>& getTrainingErrors() const { return trainingErrors_; }
+    
+    /**
+     * @brief Résultats du dernier entraînement terminé (débit, arrêt...)
+     */
+    const Trainer::TrainingResults& getTrainingResults() const { return trainingResults_; }
+    
+    /**
+     * @brief Recrée le pool de threads de calcul
+     * @param options Nombre de threads et placement sur les cœurs
+     * @return False si un entraînement est en cours
+     */
+    bool configureThreadPool(const ThreadPool::Options& options);
+    
+    /**
+     * @brief Configuration effective du pool (nombre de threads résolu)
+     */
+    const ThreadPool::Options& getThreadPoolOptions() const { return threadPool_->getOptions(); }
+    
+    /**
+     * @brief Activité de chaque thread du pool depuis le début du dernier entraînement
+     */
+    std::vector<ThreadPool::WorkerStats> getThreadPoolStats() const { return threadPool_->getStats(); }
 
 signals:
     /**
      * @brief Signal émis quand l'entraînement progresse
-     * @param epoch Époque actuelle
-     * @param error Erreur moyenne
+     * Une seule émission par vidage de la file (~30 Hz) pour toutes les
+     * époques reçues depuis le précédent : le coût de l'affichage ne dépend
+     * pas du nombre d'époques
+     * @param firstEpoch Indice de la première époque du paquet
+     * @param errors Erreurs moyennes des époques firstEpoch, firstEpoch + 1...
      */
-    void trainingProgress(size_t epoch, double error);
+    void trainingProgress(size_t firstEpoch, const std::vector<double>& errors);
     
     /**
      * @brief Signal émis quand l'entraînement est terminé
      */
     void trainingFinished();
     
+    /**
+     * @brief Signal émis si l'entraînement a échoué (à la place de trainingFinished)
+     * @param message Description de l'erreur
+     */
+    void trainingFailed(const QString& message);
+    
     /**
      * @brief Signal émis quand un réseau est créé
      */
@@ -148,18 +252,95 @@ signals:
      */
     void datasetLoaded();
 
+private slots:
+    /**
+     * @brief Transmet la progression reçue du thread d'entraînement
+     * Appelé périodiquement par progressTimer_ sur le thread GUI
+     */
+    void drainTrainingProgress();
+
 private:
+    /**
+     * @brief Progression d'une époque, du thread d'entraînement vers le GUI
+     */
+    struct ProgressEvent {
+        size_t epoch;
+        double error;
+    };
+    
+    // Époques en attente au plus ; au-delà, les événements sont abandonnés
+    static constexpr size_t PROGRESS_QUEUE_CAPACITY = 8192;
+    
+    // Période de vidage de la file de progression, donc de rafraîchissement de l'interface (~30 Hz)
+    static constexpr int PROGRESS_DRAIN_INTERVAL_MS = 33;
+    
+    std::unique_ptr<ThreadPool> threadPool_;  // Déclaré en premier : détruit après ses utilisateurs
     std::shared_ptr<Network> network_;
     std::shared_ptr<Trainer> trainer_;
+    Evaluator evaluator_;         // Évaluation parallèle sur testSet_
     DatasetManager datasetManager_;
-    std::vector<DatasetManager::Sample> trainSamples_;
-    std::vector<DatasetManager::Sample> testSamples_;
+    DatasetManager::SplitOptions splitOptions_;
+    DatasetView trainSet_;        // Vues (indices) sur datasetManager_
+    DatasetView validationSet_;
+    DatasetView testSet_;
     std::vector<double> trainingErrors_;
+    uint64_t datasetVersion_;     // Incrémenté à chaque chargement ou découpage
+    
+    // Résultats mémorisés et versions avec lesquelles ils ont été calculés
+    TestResults cachedTestResults_;
+    bool testResultsValid_;
+    uint64_t testResultsNetworkVersion_;
+    uint64_t testResultsDatasetVersion_;
+    mutable std::vector<std::vector<double>> cachedCorrelationMatrix_;
+    mutable bool correlationValid_;
+    mutable uint64_t correlationDatasetVersion_;
+    
+    std::thread trainingThread_;
+    SpscQueue<ProgressEvent> progressQueue_;   // Thread d'entraînement -> GUI
+    std::vector<double> progressBatch_;        // Époques consécutives d'un vidage (réutilisé)
+    std::atomic<bool> trainingDone_;           // Le thread d'entraînement a terminé
+    Trainer::TrainingResults trainingResults_; // Écrit par le thread, lu après join
+    std::exception_ptr trainingError_;         // Exception levée pendant l'entraînement
+    QTimer* progressTimer_;
+    
+    /**
+     * @brief Attend le thread d'entraînement et publie ses résultats
+     */
+    void finishTraining();
     
     /**
      * @brief Initialise le trainer si nécessaire
      */
     void initializeTrainer();
+    
+    /**
+     * @brief Découpe le dataset chargé selon splitOptions_
+     */
+    void splitDataset();
+    
+    /**
+     * @brief Oublie les résultats mémorisés (nouveau réseau)
+     * Un nouveau réseau peut avoir la même version que l'ancien
+     */
+    void invalidateEvaluationCache();
+    
+    /**
+     * @brief Calcule la corrélation sur testSet_ (sans mémorisation)
+     */
+    std::vector<std::vector<double>> computeCorrelationMatrix() const;
+    
+    /**
+     * @brief Charge un CSV via son cache binaire, créé ou rafraîchi si besoin
+     */
+    bool loadCSVWithCache(const std::string& filename,
+                          size_t numInputs,
+                          size_t numOutputs,
+                          bool hasHeader);
+    
+    /**
+     * @brief Préfixe des caches d'un CSV (hachage de son chemin absolu)
+     */
+    static std::string cachePrefix(const std::string& filename);
 };
 
 } // namespace NeuroUIT
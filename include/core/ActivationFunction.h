@@ -42,6 +42,11 @@ public:
      */
     virtual std::string getName() const = 0;
     
+    /**
+     * @brief Type de la fonction (sert à choisir le noyau appliqué sur une couche entière)
+     */
+    virtual ActivationType getType() const = 0;
+    
     /**
      * @brief Crée une fonction d'activation à partir du type
      */
@@ -56,6 +61,7 @@ public:
     double activate(double x) const override;
     double derivative(double x) const override;
     std::string getName() const override { return "Sigmoid"; }
+    ActivationType getType() const override { return ActivationType::Sigmoid; }
 };
 
 /**
@@ -66,6 +72,7 @@ public:
     double activate(double x) const override;
     double derivative(double x) const override;
     std::string getName() const override { return "Tanh"; }
+    ActivationType getType() const override { return ActivationType::Tanh; }
 };
 
 /**
@@ -76,6 +83,7 @@ public:
     double activate(double x) const override;
     double derivative(double x) const override;
     std::string getName() const override { return "ReLU"; }
+    ActivationType getType() const override { return ActivationType::ReLU; }
 };
 
 /**
@@ -86,6 +94,7 @@ public:
     double activate(double x) const override;
     double derivative(double x) const override;
     std::string getName() const override { return "Linear"; }
+    ActivationType getType() const override { return ActivationType::Linear; }
 };
 
 } // namespace NeuroUIT
@@ -0,0 +1,62 @@
+#ifndef ACTIVATIONKERNELS_H
+#define ACTIVATIONKERNELS_H
+
+#include <cstddef>
+#include "core/ActivationFunction.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief Précision de l'évaluation de exp, sigmoid et tanh
+ *
+ * Approximate remplace std::exp/std::tanh par Kernels::fastSigmoid et
+ * Kernels::fastTanh : réduction d'argument (x = n·ln2 + r) puis polynôme de
+ * degré 7, vectorisés selon le niveau SIMD actif. Erreurs maximales :
+ * - double : sigmoid et tanh < 5e-9 en absolu
+ * - float : sigmoid et tanh < 4e-7 en absolu (limitées par la précision du float)
+ * ReLU et Linear ne sont pas concernées.
+ */
+enum class ActivationAccuracy {
+    Exact,
+    Approximate
+};
+
+/**
+ * @brief Fonctions d'activation appliquées à un buffer entier
+ *
+ * Le type d'activation est résolu une seule fois par appel : chaque cas
+ * exécute une boucle sans appel virtuel que le compilateur peut vectoriser.
+ * Les dérivées sont calculées à partir des sorties déjà activées
+ * (σ' = σ(1 − σ), tanh' = 1 − tanh²) pour ne pas réévaluer exp/tanh.
+ */
+class ActivationKernels {
+public:
+    /**
+     * @brief out[i] = f(in[i] + bias[i])
+     * @param type Fonction d'activation
+     * @param in Sommes pondérées (sans biais)
+     * @param bias Biais (nullptr pour n'en ajouter aucun)
+     * @param out Sorties activées (peut être égal à in)
+     * @param n Nombre d'éléments
+     * @param netInputs Si non nul, reçoit in[i] + bias[i] avant activation
+     * @param accuracy Évaluation exacte (libm) ou approchée
+     */
+    template <typename T>
+    static void activate(ActivationType type, const T* in, const T* bias, T* out, size_t n,
+                         T* netInputs = nullptr,
+                         ActivationAccuracy accuracy = ActivationAccuracy::Exact);
+
+    /**
+     * @brief deltas[i] *= f'(x_i), la dérivée étant déduite de outputs[i] = f(x_i)
+     * @param type Fonction d'activation
+     * @param outputs Sorties activées de la couche
+     * @param deltas Erreurs, remplacées par les deltas
+     * @param n Nombre d'éléments
+     */
+    template <typename T>
+    static void multiplyDerivative(ActivationType type, const T* outputs, T* deltas, size_t n);
+};
+
+} // namespace NeuroUIT
+
+#endif // ACTIVATIONKERNELS_H
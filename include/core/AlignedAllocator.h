@@ -0,0 +1,66 @@
+#ifndef ALIGNEDALLOCATOR_H
+#define ALIGNEDALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace NeuroUIT {
+
+/**
+ * @brief Alignement utilisé pour les buffers de calcul (une ligne de cache)
+ */
+constexpr size_t kCacheLineSize = 64;
+
+/**
+ * @brief Allocateur garantissant un alignement sur Alignment octets
+ */
+template <typename T, size_t Alignment = kCacheLineSize>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* p, size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+/**
+ * @brief Vecteur dont les données commencent sur une ligne de cache
+ */
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+/**
+ * @brief Arrondit un nombre d'éléments au multiple couvrant une ligne de cache
+ * Sert à aligner chaque ligne d'une matrice row-major
+ */
+template <typename T>
+constexpr size_t alignedStride(size_t numElements) {
+    constexpr size_t perLine = kCacheLineSize / sizeof(T);
+    return (numElements + perLine - 1) / perLine * perLine;
+}
+
+} // namespace NeuroUIT
+
+#endif // ALIGNEDALLOCATOR_H
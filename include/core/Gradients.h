@@ -0,0 +1,85 @@
+#ifndef GRADIENTS_H
+#define GRADIENTS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "core/AlignedAllocator.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief Gradient de tous les paramètres d'un réseau dans un seul buffer
+ *
+ * Pour chaque couche : les gradients des poids (même forme et même stride que
+ * la matrice de poids de la couche) puis ceux des biais, chaque bloc commençant
+ * sur une ligne de cache. Le buffer étant contigu, deux gradients se
+ * combinent par simple addition élément par élément, sur tout ou partie du
+ * buffer. Créé par Network::createGradients().
+ *
+ * @tparam T Type scalaire du réseau (float ou double)
+ */
+template <typename T>
+class BasicGradients {
+public:
+    BasicGradients() : count_(0) {}
+
+    /**
+     * @brief Constructeur
+     * @param weightSizes Nombre d'éléments de la matrice de poids de chaque couche
+     * @param biasSizes Nombre de biais de chaque couche
+     */
+    BasicGradients(const std::vector<size_t>& weightSizes, const std::vector<size_t>& biasSizes)
+        : count_(0)
+    {
+        size_t offset = 0;
+        for (size_t i = 0; i < weightSizes.size(); ++i) {
+            weightOffsets_.push_back(offset);
+            offset += alignedStride<T>(weightSizes[i]);
+            biasOffsets_.push_back(offset);
+            offset += alignedStride<T>(biasSizes[i]);
+        }
+        data_.assign(offset, T(0));
+    }
+
+    T* weights(size_t layer) { return data_.data() + weightOffsets_[layer]; }
+    const T* weights(size_t layer) const { return data_.data() + weightOffsets_[layer]; }
+
+    T* biases(size_t layer) { return data_.data() + biasOffsets_[layer]; }
+    const T* biases(size_t layer) const { return data_.data() + biasOffsets_[layer]; }
+
+    T* data() { return data_.data(); }
+    const T* data() const { return data_.data(); }
+
+    /**
+     * @brief Nombre total d'éléments du buffer (remplissage compris)
+     */
+    size_t size() const { return data_.size(); }
+
+    /**
+     * @brief Nombre d'échantillons accumulés
+     */
+    size_t getCount() const { return count_; }
+    void setCount(size_t count) { count_ = count; }
+
+    /**
+     * @brief Remet le gradient à zéro
+     */
+    void clear() {
+        std::fill(data_.begin(), data_.end(), T(0));
+        count_ = 0;
+    }
+
+private:
+    std::vector<size_t> weightOffsets_;   // Début des poids de chaque couche
+    std::vector<size_t> biasOffsets_;     // Début des biais de chaque couche
+    AlignedVector<T> data_;               // Tous les gradients, bout à bout
+    size_t count_;                        // Échantillons accumulés
+};
+
+using Gradients = BasicGradients<double>;
+using GradientsF = BasicGradients<float>;
+
+} // namespace NeuroUIT
+
+#endif // GRADIENTS_H
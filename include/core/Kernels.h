@@ -0,0 +1,101 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <cstddef>
+#include <string>
+
+namespace NeuroUIT {
+
+/**
+ * @brief Jeux d'instructions SIMD supportés par les noyaux de calcul
+ */
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @brief Noyaux de calcul vectoriels avec sélection à l'exécution
+ *
+ * Le jeu d'instructions est détecté via CPUID au premier appel. La variable
+ * d'environnement NEUROUIT_SIMD (scalar, sse2, avx2, avx512) permet de forcer
+ * un niveau inférieur pour comparer les implémentations sur un même binaire ;
+ * un niveau non supporté par le processeur est ramené au meilleur disponible.
+ */
+class Kernels {
+public:
+    /**
+     * @brief Produit scalaire Σ x[i] * y[i]
+     */
+    static double dot(const double* x, const double* y, size_t n);
+
+    /**
+     * @brief y += alpha * x
+     * Sert à la rétroprojection des erreurs (ligne par ligne de W)
+     * et à l'accumulation des gradients
+     */
+    static void axpy(size_t n, double alpha, const double* x, double* y);
+
+    /**
+     * @brief Descente de gradient avec momentum, puis remise à zéro du gradient
+     * velocity = momentum * velocity - step * gradient ; weights += velocity ; gradient = 0
+     */
+    static void momentumUpdate(size_t n, double step, double momentum,
+                               double* weights, double* velocity, double* gradient);
+
+    /**
+     * @brief Versions simple précision (deux fois plus d'éléments par registre)
+     */
+    static float dot(const float* x, const float* y, size_t n);
+    static void axpy(size_t n, float alpha, const float* x, float* y);
+    static void momentumUpdate(size_t n, float step, float momentum,
+                               float* weights, float* velocity, float* gradient);
+
+    /**
+     * @brief Approximation de exp(x), arguments bornés à ±80
+     * Erreur relative < 1e-8 en double, < 2e-7 en float
+     */
+    static double fastExp(double x);
+    static float fastExp(float x);
+
+    /**
+     * @brief y[i] = sigmoid(x[i]) approchée via fastExp (y peut être égal à x)
+     * Erreur absolue < 5e-9 en double, < 2e-7 en float
+     */
+    static void fastSigmoid(const double* x, double* y, size_t n);
+    static void fastSigmoid(const float* x, float* y, size_t n);
+
+    /**
+     * @brief y[i] = tanh(x[i]) approchée via fastExp (y peut être égal à x)
+     * Erreur absolue < 5e-9 en double, < 4e-7 en float
+     */
+    static void fastTanh(const double* x, double* y, size_t n);
+    static void fastTanh(const float* x, float* y, size_t n);
+
+    /**
+     * @brief Meilleur niveau SIMD supporté par le processeur
+     */
+    static SimdLevel detectLevel();
+
+    /**
+     * @brief Niveau SIMD actuellement utilisé
+     */
+    static SimdLevel getLevel();
+
+    /**
+     * @brief Force un niveau SIMD (ramené au niveau supporté si nécessaire)
+     * @return Niveau effectivement sélectionné
+     */
+    static SimdLevel setLevel(SimdLevel level);
+
+    /**
+     * @brief Nom d'un niveau SIMD (scalar, sse2, avx2, avx512)
+     */
+    static std::string levelName(SimdLevel level);
+};
+
+} // namespace NeuroUIT
+
+#endif // KERNELS_H
@@ -6,96 +6,261 @@
 #include <random>
 #include "core/Neuron.h"
 #include "core/ActivationFunction.h"
+#include "core/ActivationKernels.h"
+#include "core/AlignedAllocator.h"
+#include "core/Matrix.h"
+#include "core/Span.h"
 
 namespace NeuroUIT {
 
 /**
  * @brief Représente une couche de neurones dans un réseau
+ *
+ * Les poids sont stockés dans une matrice row-major alignée
+ * (une ligne par neurone, stride arrondi à une ligne de cache)
+ * et les biais dans un vecteur contigu.
+ *
+ * @tparam T Type scalaire des poids et activations (float ou double)
  */
-class Layer {
+template <typename T>
+class BasicLayer {
 public:
+    using Neuron = BasicNeuron<T>;
+    using Matrix = BasicMatrix<T>;
+    using MatrixView = BasicMatrixView<T>;
+
     /**
      * @brief Constructeur
      * @param numNeurons Nombre de neurones dans la couche
      * @param numInputs Nombre d'entrées pour chaque neurone
      * @param activation Fonction d'activation partagée par tous les neurones
      */
-    Layer(size_t numNeurons, size_t numInputs, 
-          std::shared_ptr<ActivationFunction> activation);
-    
+    BasicLayer(size_t numNeurons, size_t numInputs,
+               std::shared_ptr<ActivationFunction> activation);
+
     /**
      * @brief Initialise les poids de tous les neurones
+     * Remet aussi à zéro le momentum et les gradients accumulés
      * @param generator Générateur aléatoire
      * @param mean Moyenne pour l'initialisation
      * @param stddev Écart-type pour l'initialisation
      */
     void initializeWeights(std::mt19937& generator, double mean = 0.0, double stddev = 0.1);
-    
+
     /**
      * @brief Propagation avant (forward pass)
+     * Écrit dans les buffers de la couche, sans allocation
+     * @param inputs Valeurs d'entrée
+     * @return Vue sur les sorties de la couche (valide jusqu'au prochain forward)
+     */
+    Span<const T> forward(Span<const T> inputs);
+
+    /**
+     * @brief Propagation avant sans état, utilisable depuis plusieurs threads
+     * Ne modifie pas la couche : les sorties sont écrites dans le buffer fourni
      * @param inputs Valeurs d'entrée
-     * @return Sorties de la couche
+     * @param outputs Reçoit les sorties (au moins numNeurons éléments)
+     */
+    void forward(Span<const T> inputs, Span<T> outputs) const;
+
+    /**
+     * @brief Propagation avant sur un lot d'échantillons (produit matrice-matrice)
+     * N'utilise ni ne modifie l'état interne de la couche
+     * @param inputs Entrées (une ligne par échantillon, numInputs colonnes)
+     * @param outputs Sorties (redimensionnée en N x numNeurons)
+     * @param netInputs Si non nul, reçoit les sommes pondérées avant activation (N x numNeurons)
+     */
+    void forwardBatch(MatrixView inputs, Matrix& outputs, Matrix* netInputs = nullptr) const;
+
+    /**
+     * @brief Rétropropagation (backward pass) et accumulation du gradient
+     * @param errors Dérivée de l'erreur par rapport aux sorties de la couche
+     * @param prevLayerOutputs Sorties de la couche précédente (entrées de cette couche)
+     */
+    void backward(Span<const T> errors, Span<const T> prevLayerOutputs);
+
+    /**
+     * @brief Rétropropagation sur un lot et accumulation du gradient
+     *
+     * Calcule δ = errors ⊙ f'(net), accumule dW += δᵀ · X et db += Σ δ en un
+     * seul produit matriciel, puis propage δ · W vers la couche précédente.
+     * f'(net) est déduite des sorties activées, sans réévaluer la fonction.
+     *
+     * @param inputs Entrées du lot (N x numInputs)
+     * @param outputs Sorties activées du lot (N x numNeurons)
+     * @param errors Dérivée de l'erreur par rapport aux sorties (N x numNeurons), remplacée par δ
+     * @param prevErrors Si non nul, reçoit les erreurs pour la couche précédente (N x numInputs)
+     */
+    void backwardBatch(MatrixView inputs, const Matrix& outputs,
+                       Matrix& errors, Matrix* prevErrors);
+
+    /**
+     * @brief Rétropropagation sur un lot, gradient accumulé hors de la couche
+     * Identique à backwardBatch, mais dW et db sont ajoutés aux buffers fournis :
+     * la couche n'est pas modifiée et peut servir plusieurs threads à la fois
+     * @param weightGradients Gradient des poids (numNeurons x getWeightStride())
+     * @param biasGradients Gradient des biais (numNeurons)
      */
-    std::vector<double> forward(const std::vector<double>& inputs);
-    
+    void backwardBatch(MatrixView inputs, const Matrix& outputs,
+                       Matrix& errors, Matrix* prevErrors,
+                       T* weightGradients, T* biasGradients) const;
+
     /**
-     * @brief Rétropropagation (backward pass)
-     * @param errors Erreurs de la couche suivante
-     * @param prevLayerOutputs Sorties de la couche précédente
+     * @brief Ajoute un gradient calculé hors de la couche au gradient accumulé
+     * @param weightGradients Gradient des poids (numNeurons x getWeightStride())
+     * @param biasGradients Gradient des biais (numNeurons)
+     * @param count Nombre d'échantillons représentés
      */
-    void backward(const std::vector<double>& errors, const std::vector<double>& prevLayerOutputs);
-    
+    void accumulateGradients(const T* weightGradients, const T* biasGradients, size_t count);
+
+    /**
+     * @brief Descente de gradient directe : w -= step · g (sans momentum)
+     * N'utilise pas le gradient accumulé ; voir Network::applyGradients
+     * @param weightGradients Gradient des poids (numNeurons x getWeightStride())
+     * @param biasGradients Gradient des biais (numNeurons)
+     * @param step Pas appliqué au gradient
+     */
+    void applyGradients(const T* weightGradients, const T* biasGradients, T step);
+
     /**
      * @brief Calcule les erreurs à propager vers la couche précédente
-     * @return Erreurs pour la couche précédente
+     * @param prevErrors Reçoit les erreurs (au moins numInputs éléments)
      */
-    std::vector<double> getErrorsForPrevLayer() const;
-    
+    void computeErrorsForPrevLayer(Span<T> prevErrors) const;
+
     /**
-     * @brief Met à jour les poids de tous les neurones
+     * @brief Applique le gradient moyen accumulé depuis la dernière mise à jour
+     * Le gradient est remis à zéro ensuite
      * @param learningRate Taux d'apprentissage
      * @param momentum Facteur de momentum
      */
     void updateWeights(double learningRate, double momentum = 0.0);
-    
+
+    /**
+     * @brief Nombre d'échantillons accumulés dans le gradient courant
+     */
+    size_t getGradientCount() const { return gradientCount_; }
+
     /**
      * @brief Définit les sorties de la couche (pour la couche d'entrée)
      * @param outputs Sorties à définir
      */
-    void setOutputs(const std::vector<double>& outputs);
-    
+    void setOutputs(Span<const T> outputs);
+
+    /**
+     * @brief Obtient une vue sur un neurone de la couche
+     */
+    Neuron getNeuron(size_t index) { return Neuron(this, index); }
+    const Neuron getNeuron(size_t index) const { return Neuron(const_cast<BasicLayer*>(this), index); }
+
+    /**
+     * @brief Obtient des vues sur les neurones de la couche
+     * Les vues sont invalidées si la couche est déplacée
+     */
+    std::vector<Neuron> getNeurons();
+    const std::vector<Neuron> getNeurons() const;
+
+    /**
+     * @brief Obtient les poids d'un neurone
+     */
+    Span<const T> getWeights(size_t neuron) const {
+        return Span<const T>(weights_.data() + neuron * stride_, numInputs_);
+    }
+
+    /**
+     * @brief Définit les poids d'un neurone
+     * @throws std::out_of_range si neuron >= getNumNeurons()
+     * @throws std::invalid_argument si weights n'a pas getNumInputs() éléments
+     */
+    void setWeights(size_t neuron, const std::vector<T>& weights);
+
+    /**
+     * @brief Obtient le biais d'un neurone
+     */
+    T getBias(size_t neuron) const { return biases_[neuron]; }
+
     /**
-     * @brief Obtient les neurones de la couche
+     * @brief Définit le biais d'un neurone
      */
-    const std::vector<Neuron>& getNeurons() const { return neurons_; }
-    std::vector<Neuron>& getNeurons() { return neurons_; }
-    
+    void setBias(size_t neuron, T bias) { biases_[neuron] = bias; }
+
+    /**
+     * @brief Obtient la matrice de poids (numNeurons x stride, row-major)
+     */
+    const T* getWeightData() const { return weights_.data(); }
+
+    /**
+     * @brief Distance en éléments entre deux lignes de la matrice de poids
+     */
+    size_t getWeightStride() const { return stride_; }
+
+    /**
+     * @brief Obtient les biais de la couche
+     */
+    const AlignedVector<T>& getBiases() const { return biases_; }
+
     /**
      * @brief Obtient les sorties de la couche
      */
-    const std::vector<double>& getOutputs() const { return outputs_; }
-    
+    const std::vector<T>& getOutputs() const { return outputs_; }
+
+    /**
+     * @brief Obtient les dernières valeurs avant activation
+     */
+    const std::vector<T>& getNetInputs() const { return netInputs_; }
+
+    /**
+     * @brief Obtient les deltas de rétropropagation
+     */
+    const std::vector<T>& getDeltas() const { return deltas_; }
+
+    /**
+     * @brief Définit le delta d'un neurone
+     */
+    void setDelta(size_t neuron, T delta) { deltas_[neuron] = delta; }
+
+    /**
+     * @brief Obtient la fonction d'activation (nullptr pour la couche d'entrée)
+     */
+    std::shared_ptr<ActivationFunction> getActivation() const { return activation_; }
+
+    /**
+     * @brief Choisit l'évaluation exacte ou approchée de sigmoid/tanh
+     */
+    void setActivationAccuracy(ActivationAccuracy accuracy) { activationAccuracy_ = accuracy; }
+    ActivationAccuracy getActivationAccuracy() const { return activationAccuracy_; }
+
     /**
      * @brief Obtient le nombre de neurones
      */
-    size_t getNumNeurons() const { return neurons_.size(); }
-    
+    size_t getNumNeurons() const { return numNeurons_; }
+
     /**
      * @brief Obtient le nombre d'entrées
      */
     size_t getNumInputs() const { return numInputs_; }
 
 private:
-    std::vector<Neuron> neurons_;              // Neurones de la couche
+    size_t numNeurons_;                        // Nombre de neurones
     size_t numInputs_;                         // Nombre d'entrées
-    std::vector<double> outputs_;              // Sorties de la couche
-    std::vector<double> prevInputs_;            // Entrées précédentes (pour mise à jour des poids)
-    std::vector<std::vector<double>> prevWeightUpdates_; // Mises à jour précédentes (pour momentum)
+    size_t stride_;                            // Stride d'une ligne de poids (aligné)
+    AlignedVector<T> weights_;            // Poids (numNeurons_ x stride_, row-major)
+    AlignedVector<T> biases_;             // Biais par neurone
+    AlignedVector<T> weightGradients_;    // Gradient accumulé des poids, même forme que weights_
+    AlignedVector<T> biasGradients_;      // Gradient accumulé des biais
+    size_t gradientCount_;                     // Nombre d'échantillons accumulés
+    AlignedVector<T> weightVelocity_;     // Mises à jour précédentes (pour momentum), même forme que weights_
+    AlignedVector<T> biasVelocity_;       // Mises à jour précédentes des biais
+    std::vector<T> netInputs_;            // Sommes pondérées avant activation
+    std::vector<T> outputs_;              // Sorties de la couche
+    std::vector<T> deltas_;               // Deltas de rétropropagation
+    std::shared_ptr<ActivationFunction> activation_; // Fonction d'activation partagée
+    ActivationType activationType_;       // Noyau appliqué à la couche (Linear si pas d'activation)
+    ActivationAccuracy activationAccuracy_; // Évaluation exacte ou approchée
 };
 
+using Layer = BasicLayer<double>;
+
 } // namespace NeuroUIT
 
 #endif // LAYER_H
-
-
-
@@ -0,0 +1,61 @@
+#ifndef LINEARALGEBRA_H
+#define LINEARALGEBRA_H
+
+#include <cstddef>
+
+namespace NeuroUIT {
+
+/**
+ * @brief Produit matriciel C = A · Bᵀ (ou C += A · Bᵀ), découpé en blocs pour le cache
+ *
+ * A est m x k, B est n x k et C est m x n, tous row-major. Ce format correspond
+ * directement à un lot d'entrées (une ligne par échantillon) multiplié par une
+ * matrice de poids (une ligne par neurone).
+ *
+ * @param m Nombre de lignes de A et de C
+ * @param n Nombre de lignes de B (colonnes de C)
+ * @param k Profondeur commune
+ * @param a Données de A
+ * @param lda Stride d'une ligne de A
+ * @param b Données de B
+ * @param ldb Stride d'une ligne de B
+ * @param c Données de C
+ * @param ldc Stride d'une ligne de C
+ * @param accumulate True pour ajouter au contenu existant de C
+ */
+template <typename T>
+void gemmNT(size_t m, size_t n, size_t k,
+            const T* a, size_t lda,
+            const T* b, size_t ldb,
+            T* c, size_t ldc,
+            bool accumulate = false);
+
+/**
+ * @brief Produit matriciel C = A · B (ou C += A · B), découpé en blocs pour le cache
+ *
+ * A est m x k, B est k x n et C est m x n, tous row-major. Sert à rétropropager
+ * les deltas d'un lot (N x neurones) à travers une matrice de poids (neurones x entrées).
+ */
+template <typename T>
+void gemmNN(size_t m, size_t n, size_t k,
+            const T* a, size_t lda,
+            const T* b, size_t ldb,
+            T* c, size_t ldc,
+            bool accumulate = false);
+
+/**
+ * @brief Produit matriciel C = Aᵀ · B (ou C += Aᵀ · B), découpé en blocs pour le cache
+ *
+ * A est k x m, B est k x n et C est m x n, tous row-major. Sert à accumuler le
+ * gradient des poids δᵀ · X d'un lot (k = taille du lot).
+ */
+template <typename T>
+void gemmTN(size_t m, size_t n, size_t k,
+            const T* a, size_t lda,
+            const T* b, size_t ldb,
+            T* c, size_t ldc,
+            bool accumulate = false);
+
+} // namespace NeuroUIT
+
+#endif // LINEARALGEBRA_H
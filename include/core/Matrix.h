@@ -0,0 +1,121 @@
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include <cstddef>
+#include "core/AlignedAllocator.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief Matrice dense row-major à stockage contigu et aligné
+ * Utilisée pour les traitements par lot (une ligne par échantillon)
+ */
+template <typename T>
+class BasicMatrix {
+public:
+    BasicMatrix() : rows_(0), cols_(0) {}
+
+    BasicMatrix(size_t rows, size_t cols, T value = T(0))
+        : rows_(rows), cols_(cols), data_(rows * cols, value) {}
+
+    /**
+     * @brief Redimensionne la matrice (le contenu n'est pas conservé)
+     * La capacité déjà allouée est réutilisée
+     */
+    void resize(size_t rows, size_t cols) {
+        rows_ = rows;
+        cols_ = cols;
+        data_.resize(rows * cols);
+    }
+
+    /**
+     * @brief Réserve la capacité pour au moins numElements éléments
+     * Les resize() ultérieurs dans cette limite n'allouent pas
+     */
+    void reserve(size_t numElements) { data_.reserve(numElements); }
+
+    /**
+     * @brief Change le nombre de lignes en conservant les lignes existantes
+     * Les nouvelles lignes ne sont pas initialisées à une valeur particulière
+     */
+    void resizeRows(size_t rows) {
+        rows_ = rows;
+        data_.resize(rows * cols_);
+    }
+
+    /**
+     * @brief Ajoute une ligne en fin de matrice (values contient getCols() éléments)
+     * Les lignes existantes sont conservées ; croissance amortie comme std::vector
+     */
+    void appendRow(const T* values) {
+        data_.insert(data_.end(), values, values + cols_);
+        ++rows_;
+    }
+
+    size_t getRows() const { return rows_; }
+    size_t getCols() const { return cols_; }
+    bool isEmpty() const { return rows_ == 0 || cols_ == 0; }
+
+    T* data() { return data_.data(); }
+    const T* data() const { return data_.data(); }
+
+    T* row(size_t r) { return data_.data() + r * cols_; }
+    const T* row(size_t r) const { return data_.data() + r * cols_; }
+
+    T& operator()(size_t r, size_t c) { return data_[r * cols_ + c]; }
+    T operator()(size_t r, size_t c) const { return data_[r * cols_ + c]; }
+
+private:
+    size_t rows_;                 // Nombre de lignes
+    size_t cols_;                 // Nombre de colonnes
+    AlignedVector<T> data_;       // Données (rows_ x cols_, row-major)
+};
+
+/**
+ * @brief Vue non propriétaire, en lecture seule, sur des lignes contiguës d'une matrice
+ * Permet de traiter une partie d'un lot (par exemple la part d'un thread)
+ * sans copier ses lignes. Invalidée par tout redimensionnement de la matrice.
+ */
+template <typename T>
+class BasicMatrixView {
+public:
+    BasicMatrixView() : data_(nullptr), rows_(0), cols_(0) {}
+
+    BasicMatrixView(const T* data, size_t rows, size_t cols)
+        : data_(data), rows_(rows), cols_(cols) {}
+
+    /**
+     * @brief Vue sur toute la matrice
+     */
+    BasicMatrixView(const BasicMatrix<T>& matrix)
+        : data_(matrix.data()), rows_(matrix.getRows()), cols_(matrix.getCols()) {}
+
+    /**
+     * @brief Vue sur les lignes [begin, end)
+     */
+    BasicMatrixView slice(size_t begin, size_t end) const {
+        return BasicMatrixView(data_ + begin * cols_, end - begin, cols_);
+    }
+
+    size_t getRows() const { return rows_; }
+    size_t getCols() const { return cols_; }
+    bool isEmpty() const { return rows_ == 0 || cols_ == 0; }
+
+    const T* data() const { return data_; }
+    const T* row(size_t r) const { return data_ + r * cols_; }
+    T operator()(size_t r, size_t c) const { return data_[r * cols_ + c]; }
+
+private:
+    const T* data_;               // Première ligne de la vue
+    size_t rows_;                 // Nombre de lignes
+    size_t cols_;                 // Nombre de colonnes (pas entre deux lignes)
+};
+
+using Matrix = BasicMatrix<double>;
+using MatrixF = BasicMatrix<float>;
+using MatrixView = BasicMatrixView<double>;
+using MatrixViewF = BasicMatrixView<float>;
+
+} // namespace NeuroUIT
+
+#endif // MATRIX_H
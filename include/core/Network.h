@@ -1,32 +1,55 @@
 #ifndef NETWORK_H
 #define NETWORK_H
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <random>
 #include <string>
 #include "core/Layer.h"
 #include "core/ActivationFunction.h"
+#include "core/Gradients.h"
+#include "core/Matrix.h"
+#include "core/Precision.h"
+#include "core/Span.h"
+#include "core/Workspace.h"
 
 namespace NeuroUIT {
 
 /**
  * @brief Représente un réseau de neurones multicouche
+ *
+ * @tparam T Type scalaire des poids et activations. Network (double) reste
+ * le type par défaut ; NetworkF (float) double la largeur SIMD effective et
+ * divise par deux la bande passante mémoire nécessaire.
  */
-class Network {
+template <typename T>
+class BasicNetwork {
 public:
+    using Layer = BasicLayer<T>;
+    using Matrix = BasicMatrix<T>;
+    using MatrixView = BasicMatrixView<T>;
+    using Workspace = BasicWorkspace<T>;
+    using Gradients = BasicGradients<T>;
+    using WeightTensor = std::vector<std::vector<std::vector<T>>>;
+    
+    /**
+     * @brief Précision des scalaires de ce type de réseau
+     */
+    static constexpr Precision precision() { return PrecisionOf<T>::value; }
+    
     /**
      * @brief Constructeur
      * @param architecture Description de l'architecture : nombre de neurones par couche
      * @param activations Fonctions d'activation pour chaque couche (sauf entrée)
      */
-    Network(const std::vector<size_t>& architecture,
-            const std::vector<ActivationType>& activations);
+    BasicNetwork(const std::vector<size_t>& architecture,
+                 const std::vector<ActivationType>& activations);
     
     /**
      * @brief Constructeur par défaut (crée un réseau vide)
      */
-    Network();
+    BasicNetwork();
     
     /**
      * @brief Initialise les poids du réseau
@@ -35,21 +58,105 @@ public:
     void initializeWeights(unsigned int seed = std::random_device{}());
     
     /**
-     * @brief Propagation avant (forward pass)
+     * @brief Propagation avant (forward pass), sans allocation
+     * @param inputs Valeurs d'entrée
+     * @return Vue sur les sorties du réseau (valide jusqu'au prochain forward)
+     */
+    Span<const T> forward(Span<const T> inputs);
+
+    /**
+     * @brief Propagation avant renvoyant une copie des sorties
      * @param inputs Valeurs d'entrée
      * @return Sorties du réseau
      */
-    std::vector<double> forward(const std::vector<double>& inputs);
+    std::vector<T> forward(const std::vector<T>& inputs);
+
+    /**
+     * @brief Inférence const pour un échantillon
+     *
+     * Toutes les valeurs intermédiaires sont écrites dans le workspace fourni :
+     * le réseau n'est pas modifié et peut servir plusieurs threads à la fois,
+     * chacun avec son propre workspace (tant qu'aucun thread ne l'entraîne).
+     *
+     * @param inputs Valeurs d'entrée
+     * @param workspace Contexte créé par createWorkspace(), propre à l'appelant
+     * @return Vue sur les sorties, valide jusqu'au prochain appel avec ce workspace
+     */
+    Span<const T> predict(Span<const T> inputs, Workspace& workspace) const;
+
+    /**
+     * @brief Propagation avant sur un lot d'échantillons, sans allocation
+     * Chaque couche effectue un seul produit matrice-matrice pour tout le lot.
+     * N'affecte pas getLastOutput().
+     * @param inputs Entrées (N x nombre d'entrées, une ligne par échantillon)
+     * @param workspace Buffers de travail créés par createWorkspace()
+     * @return Sorties (N x nombre de sorties), stockées dans le workspace
+     *         (les entrées elles-mêmes pour un réseau sans couche cachée ni de sortie)
+     */
+    MatrixView forwardBatch(MatrixView inputs, Workspace& workspace) const;
+
+    /**
+     * @brief Propagation avant sur un lot avec un workspace temporaire
+     * @param inputs Entrées (N x nombre d'entrées, une ligne par échantillon)
+     * @return Sorties (N x nombre de sorties)
+     */
+    Matrix forwardBatch(MatrixView inputs) const;
     
     /**
-     * @brief Rétropropagation (backward pass)
+     * @brief Rétropropagation (backward pass) pour le dernier forward(), sans allocation
+     * Le gradient est accumulé jusqu'au prochain updateWeights()
      * @param targets Valeurs cibles (sorties attendues)
      * @return Erreur quadratique moyenne
      */
-    double backward(const std::vector<double>& targets);
+    double backward(Span<const T> targets);
+    
+    /**
+     * @brief Propagation avant puis rétropropagation sur un lot complet
+     * Chaque couche accumule dW = δᵀX et db en un seul produit matriciel ;
+     * le gradient est appliqué au prochain updateWeights()
+     * @param inputs Entrées (N x nombre d'entrées)
+     * @param targets Valeurs cibles (N x nombre de sorties)
+     * @return Erreur quadratique moyenne sur le lot
+     */
+    double backwardBatch(MatrixView inputs, MatrixView targets);
+    
+    /**
+     * @brief Propagation avant puis rétropropagation sur un lot, sans modifier le réseau
+     * Le gradient est ajouté à gradients au lieu des couches : plusieurs
+     * threads peuvent calculer en même temps le gradient de parts d'un même
+     * lot, chacun avec son workspace et son gradient
+     * @param inputs Entrées (N x nombre d'entrées)
+     * @param targets Valeurs cibles (N x nombre de sorties)
+     * @param workspace Buffers de travail créés par createWorkspace()
+     * @param gradients Gradient créé par createGradients(), accumulé
+     * @return Erreur quadratique moyenne sur le lot
+     */
+    double backwardBatch(MatrixView inputs, MatrixView targets,
+                         Workspace& workspace, Gradients& gradients) const;
     
     /**
-     * @brief Met à jour les poids après backpropagation
+     * @brief Ajoute un gradient calculé par backwardBatch(..., gradients)
+     * au gradient accumulé, appliqué au prochain updateWeights()
+     */
+    void accumulateGradients(const Gradients& gradients);
+    
+    /**
+     * @brief Applique directement le gradient moyen : w -= η · g / n (sans momentum)
+     *
+     * Mode Hogwild : plusieurs threads peuvent appeler cette méthode en même
+     * temps que d'autres calculent leur gradient sur le même réseau. Les
+     * écritures ne sont pas synchronisées : une mise à jour concurrente peut
+     * en écraser une autre, ce que la descente de gradient tolère. Ne modifie
+     * pas getVersion() (compteur non atomique) : appeler notifyWeightsChanged()
+     * une fois les threads terminés.
+     * @param gradients Gradient calculé par backwardBatch(..., gradients)
+     * @param learningRate Taux d'apprentissage
+     */
+    void applyGradients(const Gradients& gradients, double learningRate);
+    
+    /**
+     * @brief Met à jour les poids avec le gradient moyen accumulé
+     * depuis la dernière mise à jour (backward ou backwardBatch)
      * @param learningRate Taux d'apprentissage
      * @param momentum Facteur de momentum
      */
@@ -60,6 +167,17 @@ public:
      */
     std::vector<size_t> getArchitecture() const;
     
+    /**
+     * @brief Crée des buffers de travail adaptés à l'architecture du réseau
+     * @param batchCapacity Nombre de lignes réservées pour forwardBatch
+     */
+    Workspace createWorkspace(size_t batchCapacity = 0) const;
+    
+    /**
+     * @brief Crée un gradient nul dimensionné pour tous les paramètres du réseau
+     */
+    Gradients createGradients() const;
+    
     /**
      * @brief Obtient les couches
      */
@@ -74,7 +192,9 @@ public:
     /**
      * @brief Obtient la dernière sortie calculée
      */
-    const std::vector<double>& getLastOutput() const { return lastOutput_; }
+    Span<const T> getLastOutput() const {
+        return layers_.empty() ? Span<const T>() : Span<const T>(layers_.back().getOutputs());
+    }
     
     /**
      * @brief Calcule l'erreur quadratique moyenne entre prédictions et cibles
@@ -82,37 +202,81 @@ public:
      * @param targets Valeurs cibles
      * @return Erreur quadratique moyenne
      */
-    static double computeMeanSquaredError(const std::vector<double>& predictions,
-                                         const std::vector<double>& targets);
+    static double computeMeanSquaredError(Span<const T> predictions, Span<const T> targets);
     
     /**
      * @brief Obtient les poids de toutes les couches (pour sauvegarde)
      */
-    std::vector<std::vector<std::vector<double>>> getAllWeights() const;
+    WeightTensor getAllWeights() const;
     
     /**
      * @brief Définit les poids de toutes les couches (pour chargement)
      */
-    void setAllWeights(const std::vector<std::vector<std::vector<double>>>& weights);
+    void setAllWeights(const WeightTensor& weights);
     
     /**
      * @brief Obtient les fonctions d'activation
      */
     std::vector<ActivationType> getActivationTypes() const;
+    
+    /**
+     * @brief Active les approximations rapides de sigmoid/tanh sur toutes les couches
+     * Utile en inférence sur de gros volumes ; voir ActivationAccuracy pour les bornes d'erreur
+     */
+    void setActivationAccuracy(ActivationAccuracy accuracy);
+    
+    /**
+     * @brief Précision d'évaluation des activations
+     */
+    ActivationAccuracy getActivationAccuracy() const { return activationAccuracy_; }
+    
+    /**
+     * @brief Compteur incrémenté à chaque modification des poids ou des activations
+     * Permet de savoir si un résultat calculé avec ce réseau est encore valable.
+     * Les modifications directes via getLayers() ou applyGradients() ne sont
+     * comptées qu'après notifyWeightsChanged().
+     */
+    uint64_t getVersion() const { return version_; }
+    
+    /**
+     * @brief Signale une modification des poids faite hors des méthodes qui
+     * incrémentent déjà getVersion()
+     */
+    void notifyWeightsChanged() { ++version_; }
 
 private:
     std::vector<Layer> layers_;                    // Couches du réseau
     std::vector<ActivationType> activationTypes_;  // Types d'activation par couche
-    std::vector<double> lastOutput_;               // Dernière sortie calculée
+    ActivationAccuracy activationAccuracy_;        // Évaluation exacte ou approchée
+    uint64_t version_;                             // Voir getVersion()
     std::mt19937 generator_;                      // Générateur aléatoire
     
+    Workspace workspace_;                          // Buffers de backward et backwardBatch
+    
     /**
      * @brief Crée le réseau à partir de l'architecture
      */
     void createLayers(const std::vector<size_t>& architecture,
                       const std::vector<ActivationType>& activations);
+    
+    /**
+     * @brief Vérifie qu'un workspace correspond à l'architecture (sans allocation)
+     */
+    void checkWorkspace(const Workspace& workspace) const;
+    
+    /**
+     * @brief Propagation avant et rétropropagation communes aux deux backwardBatch
+     * @param layerBackward Appelée pour chaque couche, de la sortie vers l'entrée,
+     * avec (indice, entrées, sorties, erreurs, erreurs précédentes)
+     */
+    template <typename LayerBackward>
+    double backpropagateBatch(MatrixView inputs, MatrixView targets,
+                              Workspace& workspace, LayerBackward layerBackward) const;
 };
 
+using Network = BasicNetwork<double>;
+using NetworkF = BasicNetwork<float>;
+
 } // namespace NeuroUIT
 
 #endif // NETWORK_H
@@ -3,110 +3,96 @@
 
 #include <vector>
 #include <memory>
-#include <random>
 #include "core/ActivationFunction.h"
+#include "core/Span.h"
 
 namespace NeuroUIT {
 
+template <typename T>
+class BasicLayer;
+
 /**
- * @brief Représente un neurone dans le réseau
+ * @brief Vue légère sur un neurone d'une couche
+ *
+ * Les poids, biais et valeurs intermédiaires sont stockés de manière contiguë
+ * dans la Layer ; un Neuron ne fait que référencer une ligne de ces buffers.
+ * La vue est invalidée si la couche est déplacée ou détruite.
+ *
+ * @tparam T Type scalaire du réseau (float ou double)
  */
-class Neuron {
+template <typename T>
+class BasicNeuron {
 public:
     /**
      * @brief Constructeur
-     * @param numInputs Nombre de connexions entrantes
-     * @param activation Fonction d'activation (peut être nullptr pour la couche d'entrée)
-     */
-    Neuron(size_t numInputs, std::shared_ptr<ActivationFunction> activation = nullptr);
-    
-    /**
-     * @brief Initialise les poids aléatoirement
-     * @param generator Générateur de nombres aléatoires
-     * @param mean Moyenne pour l'initialisation
-     * @param stddev Écart-type pour l'initialisation
+     * @param layer Couche propriétaire des données
+     * @param index Indice du neurone dans la couche
      */
-    void initializeWeights(std::mt19937& generator, double mean = 0.0, double stddev = 1.0);
-    
+    BasicNeuron(BasicLayer<T>* layer, size_t index);
+
     /**
      * @brief Définit les poids manuellement
      * @param weights Nouveaux poids (doit avoir la bonne taille)
      */
-    void setWeights(const std::vector<double>& weights);
-    
+    void setWeights(const std::vector<T>& weights);
+
     /**
      * @brief Obtient les poids
      */
-    const std::vector<double>& getWeights() const { return weights_; }
-    
+    Span<const T> getWeights() const;
+
     /**
      * @brief Obtient le biais
      */
-    double getBias() const { return bias_; }
-    
+    T getBias() const;
+
     /**
      * @brief Définit le biais
      */
-    void setBias(double bias) { bias_ = bias; }
-    
-    /**
-     * @brief Calcule la sortie du neurone (forward pass)
-     * @param inputs Valeurs d'entrée
-     * @return Valeur activée
-     */
-    double forward(const std::vector<double>& inputs);
-    
+    void setBias(T bias);
+
     /**
      * @brief Obtient la dernière sortie calculée
      */
-    double getOutput() const { return output_; }
-    
+    T getOutput() const;
+
     /**
      * @brief Obtient la dernière valeur avant activation
      */
-    double getNetInput() const { return netInput_; }
-    
+    T getNetInput() const;
+
     /**
      * @brief Obtient la dérivée de l'erreur par rapport à la sortie
      */
-    double getDelta() const { return delta_; }
-    
+    T getDelta() const;
+
     /**
      * @brief Définit la dérivée de l'erreur (pour backpropagation)
      */
-    void setDelta(double delta) { delta_ = delta; }
-    
-    /**
-     * @brief Met à jour les poids et le biais (après calcul du delta)
-     * @param inputs Valeurs d'entrée utilisées dans forward
-     * @param learningRate Taux d'apprentissage
-     * @param momentum Facteur de momentum (0 pour désactiver)
-     * @param prevWeightUpdates Mises à jour précédentes pour momentum
-     */
-    void updateWeights(const std::vector<double>& inputs, double learningRate, 
-                      double momentum, std::vector<double>& prevWeightUpdates);
-    
+    void setDelta(T delta);
+
     /**
      * @brief Obtient le nombre d'entrées
      */
-    size_t getNumInputs() const { return weights_.size(); }
-    
+    size_t getNumInputs() const;
+
     /**
      * @brief Obtient la fonction d'activation
      */
-    std::shared_ptr<ActivationFunction> getActivation() const { return activation_; }
+    std::shared_ptr<ActivationFunction> getActivation() const;
+
+    /**
+     * @brief Obtient l'indice du neurone dans sa couche
+     */
+    size_t getIndex() const { return index_; }
 
 private:
-    std::vector<double> weights_;  // Poids des connexions entrantes
-    double bias_;                   // Biais du neurone
-    double output_;                 // Dernière sortie calculée
-    double netInput_;              // Dernière somme avant activation
-    double delta_;                 // Dérivée de l'erreur (pour backpropagation)
-    std::shared_ptr<ActivationFunction> activation_; // Fonction d'activation
+    BasicLayer<T>* layer_;  // Couche propriétaire (non possédée)
+    size_t index_;          // Ligne correspondante dans la matrice de poids
 };
 
+using Neuron = BasicNeuron<double>;
+
 } // namespace NeuroUIT
 
 #endif // NEURON_H
-
-
@@ -0,0 +1,41 @@
+#ifndef PRECISION_H
+#define PRECISION_H
+
+#include <string>
+
+namespace NeuroUIT {
+
+/**
+ * @brief Précision des scalaires d'un réseau
+ */
+enum class Precision {
+    Float,
+    Double
+};
+
+/**
+ * @brief Précision correspondant à un type scalaire
+ */
+template <typename T>
+struct PrecisionOf;
+
+template <>
+struct PrecisionOf<float> {
+    static constexpr Precision value = Precision::Float;
+};
+
+template <>
+struct PrecisionOf<double> {
+    static constexpr Precision value = Precision::Double;
+};
+
+/**
+ * @brief Nom d'une précision (tel qu'écrit dans les fichiers .nui)
+ */
+inline std::string precisionName(Precision precision) {
+    return precision == Precision::Float ? "float" : "double";
+}
+
+} // namespace NeuroUIT
+
+#endif // PRECISION_H
@@ -0,0 +1,54 @@
+#ifndef SPAN_H
+#define SPAN_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace NeuroUIT {
+
+/**
+ * @brief Vue non propriétaire sur une zone mémoire contiguë
+ * Équivalent minimal de std::span (C++20) pour le code C++17
+ */
+template <typename T>
+class Span {
+public:
+    using value_type = std::remove_cv_t<T>;
+    using iterator = T*;
+
+    Span() : data_(nullptr), size_(0) {}
+    Span(T* data, size_t size) : data_(data), size_(size) {}
+
+    /**
+     * @brief Construit une vue sur un conteneur contigu (std::vector, ...)
+     */
+    template <typename Container,
+              typename = std::enable_if_t<std::is_convertible<
+                  decltype(std::declval<Container&>().data()), T*>::value>>
+    Span(Container& container)
+        : data_(container.data()), size_(container.size()) {}
+
+    template <typename Container,
+              typename = std::enable_if_t<std::is_convertible<
+                  decltype(std::declval<const Container&>().data()), T*>::value>>
+    Span(const Container& container)
+        : data_(container.data()), size_(container.size()) {}
+
+    T* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    T& operator[](size_t i) const { return data_[i]; }
+
+    iterator begin() const { return data_; }
+    iterator end() const { return data_ + size_; }
+
+private:
+    T* data_;
+    size_t size_;
+};
+
+} // namespace NeuroUIT
+
+#endif // SPAN_H
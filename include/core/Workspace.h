@@ -0,0 +1,122 @@
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <vector>
+#include <cstddef>
+#include "core/AlignedAllocator.h"
+#include "core/Matrix.h"
+#include "core/Span.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief Buffers de travail préalloués pour une architecture de réseau
+ *
+ * Regroupe tout ce que la propagation et la rétropropagation écrivent en
+ * dehors des couches : les activations et erreurs d'un échantillon (zones
+ * alternées découpées dans une arène unique) et les matrices d'un lot (sorties
+ * de chaque couche, erreurs alternées). Une fois dimensionné, un workspace
+ * n'alloue plus : les matrices de lot ne grandissent que si un lot dépasse la
+ * capacité réservée.
+ *
+ * Sert aussi de contexte d'inférence : Network::predict et
+ * Network::forwardBatch sont const et n'écrivent que dans le workspace fourni,
+ * si bien que plusieurs threads peuvent interroger le même réseau avec chacun
+ * leur propre workspace.
+ *
+ * @tparam T Type scalaire du réseau (float ou double)
+ */
+template <typename T>
+class BasicWorkspace {
+public:
+    using Matrix = BasicMatrix<T>;
+
+    /**
+     * @brief Constructeur par défaut (workspace vide)
+     */
+    BasicWorkspace();
+
+    /**
+     * @brief Constructeur
+     * @param architecture Nombre de neurones par couche (entrée comprise)
+     * @param batchCapacity Nombre de lignes réservées pour les traitements par lot
+     */
+    explicit BasicWorkspace(const std::vector<size_t>& architecture, size_t batchCapacity = 0);
+
+    /**
+     * @brief Réserve les matrices de lot pour batchCapacity lignes
+     * Seul appel susceptible d'allouer après la construction
+     */
+    void reserveBatch(size_t batchCapacity);
+
+    /**
+     * @brief Indique si le workspace correspond à l'architecture donnée
+     */
+    bool matches(const std::vector<size_t>& architecture) const { return architecture == architecture_; }
+
+    /**
+     * @brief Zone d'activations pour l'inférence d'un échantillon
+     * @param slot 0 ou 1 (les couches alternent entre les deux zones)
+     */
+    Span<T> activations(size_t slot) {
+        return Span<T>(arena_.data() + (2 + slot) * errorStride_, maxWidth_);
+    }
+
+    /**
+     * @brief Zone d'erreurs de la couche courante (largeur maximale du réseau)
+     */
+    Span<T> errors() { return Span<T>(arena_.data() + current_ * errorStride_, maxWidth_); }
+
+    /**
+     * @brief Zone d'erreurs propagées vers la couche précédente
+     */
+    Span<T> prevErrors() { return Span<T>(arena_.data() + (1 - current_) * errorStride_, maxWidth_); }
+
+    /**
+     * @brief Échange errors() et prevErrors() (passage à la couche précédente)
+     */
+    void swapErrors() { current_ = 1 - current_; }
+
+    /**
+     * @brief Sorties d'une couche pour le lot courant
+     */
+    Matrix& batchOutputs(size_t layer) { return batchOutputs_[layer]; }
+
+    /**
+     * @brief Erreurs de la couche courante pour le lot
+     */
+    Matrix& batchErrors() { return batchErrors_; }
+
+    /**
+     * @brief Erreurs propagées vers la couche précédente pour le lot
+     */
+    Matrix& batchPrevErrors() { return batchPrevErrors_; }
+
+    /**
+     * @brief Obtient l'architecture pour laquelle le workspace est dimensionné
+     */
+    const std::vector<size_t>& getArchitecture() const { return architecture_; }
+
+    /**
+     * @brief Nombre de lignes réservées pour les lots
+     */
+    size_t getBatchCapacity() const { return batchCapacity_; }
+
+private:
+    std::vector<size_t> architecture_;    // Neurones par couche
+    size_t maxWidth_;                     // Plus grande couche
+    size_t errorStride_;                  // Largeur alignée d'une zone de l'arène
+    size_t batchCapacity_;                // Lignes réservées pour les lots
+    int current_;                         // Zone d'erreurs courante (0 ou 1)
+    AlignedVector<T> arena_;              // Zones d'erreurs puis d'activations d'un échantillon
+    std::vector<Matrix> batchOutputs_;    // Sorties de chaque couche pour le lot
+    Matrix batchErrors_;                  // Erreurs de la couche courante
+    Matrix batchPrevErrors_;              // Erreurs propagées vers la couche précédente
+};
+
+using Workspace = BasicWorkspace<double>;
+using WorkspaceF = BasicWorkspace<float>;
+
+} // namespace NeuroUIT
+
+#endif // WORKSPACE_H
@@ -3,21 +3,57 @@
 
 #include <vector>
 #include <string>
-#include <utility>
+#include <cstdint>
+#include <memory>
+#include "core/Matrix.h"
+#include "core/Span.h"
+#include "dataset/MappedFile.h"
 
 namespace NeuroUIT {
 
+class DatasetView;
+class ThreadPool;
+struct DatasetSplit;
+
 /**
  * @brief Gère le chargement et la manipulation de datasets
+ *
+ * Les entrées et les sorties sont stockées dans deux blocs contigus row-major,
+ * soit en mémoire (chargement CSV), soit directement dans la projection d'un
+ * fichier binaire .nuid (loadFromBinary).
  */
 class DatasetManager {
 public:
     /**
-     * @brief Structure représentant un échantillon (entrées + sorties)
+     * @brief Extension des fichiers binaires de datasets
+     */
+    static constexpr const char* BINARY_EXTENSION = ".nuid";
+    
+    /**
+     * @brief Version du format binaire
+     */
+    static constexpr uint32_t BINARY_VERSION = 1;
+    
+    /**
+     * @brief Vue sur un échantillon (entrées + sorties)
+     *
+     * Les valeurs ne sont pas possédées : elles pointent sur une ligne des
+     * matrices contiguës du DatasetManager. La vue est invalidée par clear()
+     * ou par un nouveau chargement.
      */
     struct Sample {
-        std::vector<double> inputs;   // Valeurs d'entrée
-        std::vector<double> outputs;   // Valeurs de sortie (cibles)
+        Span<const double> inputs;    // Valeurs d'entrée
+        Span<const double> outputs;   // Valeurs de sortie (cibles)
+    };
+    
+    /**
+     * @brief Options de découpage train / validation / test
+     */
+    struct SplitOptions {
+        double trainRatio = 0.8;       // Proportion pour l'entraînement
+        double validationRatio = 0.0;  // Proportion pour la validation (0 = aucune)
+        uint32_t seed = 42;            // Graine du mélange (même graine = même découpage)
+        bool stratify = false;         // Conserver la proportion de chaque classe
     };
     
     /**
@@ -44,26 +80,85 @@ public:
      */
     DatasetManager();
     
+    DatasetManager(const DatasetManager&) = delete;
+    DatasetManager& operator=(const DatasetManager&) = delete;
+    
     /**
      * @brief Charge un dataset depuis un fichier CSV
+     *
+     * Le fichier est lu par grands blocs ; chaque bloc est découpé aux fins de
+     * ligne et ses morceaux sont analysés en parallèle sur le pool de threads
+     * (std::from_chars) directement dans les matrices du dataset. Les lignes
+     * vides sont ignorées ; une valeur invalide, NaN ou infinie fait échouer
+     * le chargement.
+     *
      * @param filename Nom du fichier CSV
      * @param numInputs Nombre de colonnes d'entrée
      * @param numOutputs Nombre de colonnes de sortie
      * @param hasHeader True si la première ligne contient des en-têtes
+     * @param numThreads Nombre de morceaux par bloc (0 = parallélisme du pool, 1 sans pool)
      * @return True si chargé avec succès
      */
     bool loadFromCSV(const std::string& filename, 
                     size_t numInputs, 
                     size_t numOutputs,
-                    bool hasHeader = false);
+                    bool hasHeader = false,
+                    size_t numThreads = 0);
+    
+    /**
+     * @brief Ouvre un dataset binaire .nuid par projection en mémoire
+     *
+     * Format (octets little-endian) : en-tête fixe (magic "NUID", version,
+     * type des valeurs, nombre d'échantillons, d'entrées et de sorties,
+     * positions des blocs, somme de contrôle FNV-1a), noms des colonnes séparés
+     * par '\0', puis les entrées et les sorties en deux blocs row-major alignés.
+     * Aucune valeur n'est analysée ni copiée : les échantillons pointent dans
+     * la projection.
+     *
+     * @param filename Nom du fichier binaire
+     * @param verifyChecksum True pour vérifier la somme de contrôle des données
+     *                       (parcourt tout le fichier une fois)
+     * @return True si ouvert avec succès
+     */
+    bool loadFromBinary(const std::string& filename, bool verifyChecksum = true);
+    
+    /**
+     * @brief Enregistre le dataset au format binaire .nuid
+     * @param filename Nom du fichier binaire
+     * @return True si enregistré avec succès
+     */
+    bool saveToBinary(const std::string& filename) const;
+    
+    /**
+     * @brief Convertit un fichier CSV au format binaire .nuid
+     * @param csvFilename Fichier CSV source (mêmes règles que loadFromCSV)
+     * @param binaryFilename Fichier binaire destination
+     * @param numInputs Nombre de colonnes d'entrée
+     * @param numOutputs Nombre de colonnes de sortie
+     * @param hasHeader True si la première ligne contient des en-têtes
+     * @return True si converti avec succès
+     */
+    static bool convertCSVToBinary(const std::string& csvFilename,
+                                   const std::string& binaryFilename,
+                                   size_t numInputs,
+                                   size_t numOutputs,
+                                   bool hasHeader = false);
     
     /**
-     * @brief Divise le dataset en ensembles d'entraînement et de test
-     * @param trainRatio Proportion pour l'entraînement (0.0 à 1.0)
-     * @return Paire (trainSamples, testSamples)
+     * @brief Divise le dataset en ensembles d'entraînement, de validation et de test
+     *
+     * Les données ne sont pas copiées : chaque ensemble est une liste d'indices
+     * sur les échantillons du dataset. Le mélange (Fisher-Yates sur mt19937)
+     * ne dépend que de la graine, quelle que soit la bibliothèque standard.
+     * Avec stratify, les échantillons sont groupés par classe (valeur de la
+     * sortie s'il n'y en a qu'une, indice de la sortie maximale sinon) et
+     * chaque classe est répartie selon les mêmes proportions. Le test reçoit
+     * les échantillons restants.
+     *
+     * @param options Proportions, graine et stratification
+     * @return Ensembles disjoints (vides si le dataset est vide)
      */
-    std::pair<std::vector<Sample>, std::vector<Sample>> 
-    splitTrainTest(double trainRatio = 0.8);
+    DatasetSplit split(const SplitOptions& options) const;
     
     /**
      * @brief Obtient toutes les statistiques du dataset
@@ -71,15 +166,71 @@ public:
      */
     Statistics getStatistics() const;
     
+    /**
+     * @brief Copie les entrées d'échantillons désignés par leurs indices
+     * Permet d'assembler un lot mélangé sans déplacer les échantillons
+     * @param indices Indices des échantillons du lot, dans l'ordre voulu
+     * @param inputs Matrice destination (une ligne par indice),
+     *               convertie au type scalaire du réseau
+     */
+    template <typename T>
+    void packInputs(Span<const uint32_t> indices, BasicMatrix<T>& inputs) const;
+    
+    /**
+     * @brief Copie les sorties d'échantillons désignés par leurs indices
+     * @param indices Indices des échantillons du lot, dans l'ordre voulu
+     * @param outputs Matrice destination (une ligne par indice),
+     *                convertie au type scalaire du réseau
+     */
+    template <typename T>
+    void packOutputs(Span<const uint32_t> indices, BasicMatrix<T>& outputs) const;
+    
+    /**
+     * @brief Analyse une ligne CSV dans une ligne d'entrées et de sorties
+     * Les champs vides sont ignorés, comme les espaces autour des valeurs
+     * @param begin Début de la ligne
+     * @param end Fin de la ligne (sans le '\n')
+     * @param numInputs Nombre de colonnes d'entrée
+     * @param numOutputs Nombre de colonnes de sortie
+     * @param inputs Destination des numInputs premières valeurs
+     * @param outputs Destination des numOutputs valeurs suivantes
+     * @return True si la ligne contient exactement le bon nombre de valeurs finies
+     */
+    static bool parseCSVLine(const char* begin, const char* end,
+                             size_t numInputs, size_t numOutputs,
+                             double* inputs, double* outputs);
+    
     /**
      * @brief Vide le dataset
      */
     void clear();
     
     /**
-     * @brief Obtient tous les échantillons
+     * @brief Obtient une vue sur l'échantillon d'indice index
      */
-    const std::vector<Sample>& getSamples() const { return samples_; }
+    Sample getSample(size_t index) const {
+        return {Span<const double>(inputData_ + index * numInputs_, numInputs_),
+                Span<const double>(outputData_ + index * numOutputs_, numOutputs_)};
+    }
+    
+    /**
+     * @brief Obtient toutes les entrées (row-major, une ligne par échantillon)
+     */
+    Span<const double> getInputData() const {
+        return Span<const double>(inputData_, numSamples_ * numInputs_);
+    }
+    
+    /**
+     * @brief Obtient toutes les sorties (row-major, une ligne par échantillon)
+     */
+    Span<const double> getOutputData() const {
+        return Span<const double>(outputData_, numSamples_ * numOutputs_);
+    }
+    
+    /**
+     * @brief Noms des colonnes (en-tête CSV), vide si le fichier n'en a pas
+     */
+    const std::vector<std::string>& getColumnNames() const { return columnNames_; }
     
     /**
      * @brief Obtient le nombre d'entrées
@@ -94,31 +245,47 @@ public:
     /**
      * @brief Vérifie si le dataset est vide
      */
-    bool isEmpty() const { return samples_.empty(); }
+    bool isEmpty() const { return numSamples_ == 0; }
     
     /**
      * @brief Obtient le nombre d'échantillons
      */
-    size_t getNumSamples() const { return samples_.size(); }
+    size_t getNumSamples() const { return numSamples_; }
+    
+    /**
+     * @brief Pool de threads du chargement CSV (nullptr = analyse séquentielle)
+     * Le pool doit survivre au DatasetManager ; clear() ne le retire pas
+     */
+    void setThreadPool(ThreadPool* pool) { threadPool_ = pool; }
 
 private:
-    std::vector<Sample> samples_;  // Tous les échantillons
+    Matrix inputs_;                // Entrées chargées depuis un CSV
+    Matrix outputs_;               // Sorties chargées depuis un CSV
+    std::unique_ptr<MappedFile> mappedFile_;  // Fichier binaire projeté (sinon nul)
+    const double* inputData_;      // Entrées (inputs_ ou projection)
+    const double* outputData_;     // Sorties (outputs_ ou projection)
+    size_t numSamples_;            // Nombre d'échantillons
     size_t numInputs_;             // Nombre d'entrées par échantillon
     size_t numOutputs_;             // Nombre de sorties par échantillon
+    std::vector<std::string> columnNames_;  // Noms des colonnes (optionnels)
+    ThreadPool* threadPool_;       // Pool du chargement CSV (non possédé)
     
     /**
-     * @brief Parse une ligne CSV en vecteur de doubles
-     * @param line Ligne CSV
-     * @return Vecteur de valeurs
+     * @brief Analyse toutes les lignes non vides d'un morceau de texte
+     * @param begin Début du morceau (début de ligne)
+     * @param end Fin du morceau (fin de ligne)
+     * @param firstRow Ligne des matrices recevant la première ligne du morceau
+     * @return True si toutes les lignes sont valides
      */
-    std::vector<double> parseCSVLine(const std::string& line);
+    bool parseCSVRows(const char* begin, const char* end, size_t firstRow);
     
     /**
-     * @brief Valide un échantillon
-     * @param sample Échantillon à valider
-     * @return True si valide
+     * @brief Accumule min, max et somme de chaque colonne d'un bloc row-major
+     * Parcourt le stockage contigu ligne par ligne
      */
-    bool validateSample(const Sample& sample) const;
+    static void accumulateColumns(const double* values, size_t rows, size_t cols,
+                                  std::vector<double>& min, std::vector<double>& max,
+                                  std::vector<double>& sum);
 };
 
 } // namespace NeuroUIT
@@ -0,0 +1,69 @@
+#ifndef DATASETVIEW_H
+#define DATASETVIEW_H
+
+#include <cstdint>
+#include <vector>
+#include "core/Span.h"
+#include "dataset/DatasetManager.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief Sous-ensemble d'un dataset désigné par des indices d'échantillons
+ *
+ * Seuls les indices (4 octets par échantillon) sont stockés : les valeurs
+ * restent dans le DatasetManager, qui doit survivre à la vue. La vue est
+ * invalidée par DatasetManager::clear() ou par un nouveau chargement.
+ */
+class DatasetView {
+public:
+    DatasetView() : dataset_(nullptr) {}
+
+    /**
+     * @brief Constructeur
+     * @param dataset Dataset référencé
+     * @param indices Indices des échantillons, dans l'ordre de la vue
+     */
+    DatasetView(const DatasetManager& dataset, std::vector<uint32_t> indices)
+        : dataset_(&dataset), indices_(std::move(indices)) {}
+
+    size_t size() const { return indices_.size(); }
+    bool empty() const { return indices_.empty(); }
+
+    /**
+     * @brief Échantillon à la position i de la vue
+     */
+    DatasetManager::Sample operator[](size_t i) const {
+        return dataset_->getSample(indices_[i]);
+    }
+
+    /**
+     * @brief Indices des échantillons dans le dataset
+     */
+    Span<const uint32_t> getIndices() const { return indices_; }
+
+    /**
+     * @brief Dataset référencé (nullptr pour une vue vide par défaut)
+     */
+    const DatasetManager* getDataset() const { return dataset_; }
+
+    size_t getNumInputs() const { return dataset_ ? dataset_->getNumInputs() : 0; }
+    size_t getNumOutputs() const { return dataset_ ? dataset_->getNumOutputs() : 0; }
+
+private:
+    const DatasetManager* dataset_;   // Dataset référencé (non possédé)
+    std::vector<uint32_t> indices_;   // Indices des échantillons de la vue
+};
+
+/**
+ * @brief Découpage d'un dataset en ensembles disjoints
+ */
+struct DatasetSplit {
+    DatasetView train;        // Entraînement
+    DatasetView validation;   // Validation (vide si non demandée)
+    DatasetView test;         // Test
+};
+
+} // namespace NeuroUIT
+
+#endif // DATASETVIEW_H
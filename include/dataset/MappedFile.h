@@ -0,0 +1,47 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace NeuroUIT {
+
+/**
+ * @brief Projection en mémoire d'un fichier en lecture seule (mmap / MapViewOfFile)
+ *
+ * Les pages sont chargées à la demande par le système : l'ouverture est
+ * immédiate quelle que soit la taille du fichier. Les pointeurs obtenus via
+ * data() sont invalidés par close() ou par la destruction de l'objet.
+ */
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Projette un fichier en mémoire
+     * @param filename Chemin du fichier (non vide)
+     * @return True si la projection a réussi
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * @brief Libère la projection
+     */
+    void close();
+
+    bool isOpen() const { return data_ != nullptr; }
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const unsigned char* data_;  // Début de la projection (aligné sur une page)
+    size_t size_;                // Taille du fichier en octets
+};
+
+} // namespace NeuroUIT
+
+#endif // MAPPEDFILE_H
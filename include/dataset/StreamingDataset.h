@@ -0,0 +1,148 @@
+#ifndef STREAMINGDATASET_H
+#define STREAMINGDATASET_H
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string>
+#include "core/Matrix.h"
+#include "dataset/DatasetManager.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief Source de données lue en flux, pour les datasets plus grands que la RAM
+ *
+ * Un CSV est lu par shards de taille fixe ; un fichier .nuid est projeté en
+ * mémoire et parcouru séquentiellement (les pages sont chargées et libérées
+ * par le système). Seuls un shard et le tampon de mélange résident en mémoire.
+ *
+ * Le mélange se fait dans un tampon de taille fixe : chaque échantillon tiré
+ * au hasard dans le tampon y est remplacé par le suivant du fichier. Le
+ * mélange est donc local (limité à la taille du tampon) mais en O(1) par
+ * échantillon. rewind() relance une époque depuis le début du fichier.
+ */
+class StreamingDataset {
+public:
+    /**
+     * @brief Options de lecture
+     */
+    struct Options {
+        size_t shardSize = 4096;           // Lignes CSV lues par accès disque
+        size_t shuffleBufferSize = 65536;  // Échantillons du tampon de mélange
+        bool shuffle = true;               // Mélanger dans le tampon
+        uint32_t seed = 0;                 // Graine du mélange (0 = aléatoire)
+    };
+
+    StreamingDataset();
+    explicit StreamingDataset(const Options& options);
+
+    /**
+     * @brief Ouvre un fichier CSV (mêmes règles que DatasetManager::loadFromCSV)
+     * @param filename Nom du fichier CSV
+     * @param numInputs Nombre de colonnes d'entrée
+     * @param numOutputs Nombre de colonnes de sortie
+     * @param hasHeader True si la première ligne contient des en-têtes
+     * @return True si le fichier a pu être ouvert
+     */
+    bool openCSV(const std::string& filename,
+                 size_t numInputs,
+                 size_t numOutputs,
+                 bool hasHeader = false);
+
+    /**
+     * @brief Ouvre un fichier binaire .nuid (dimensions lues dans le fichier)
+     * @param filename Nom du fichier binaire
+     * @return True si le fichier a pu être ouvert
+     */
+    bool openBinary(const std::string& filename);
+
+    /**
+     * @brief Ferme la source
+     */
+    void close();
+
+    /**
+     * @brief Revient au début du fichier pour une nouvelle époque
+     */
+    void rewind();
+
+    /**
+     * @brief Lit le lot suivant de l'époque
+     * @param batchSize Nombre maximal d'échantillons
+     * @param inputs Matrice destination des entrées (redimensionnée au lot lu)
+     * @param outputs Matrice destination des sorties (redimensionnée au lot lu)
+     * @return Nombre d'échantillons lus, 0 en fin d'époque
+     * @throws std::runtime_error si une ligne CSV est invalide
+     */
+    template <typename T>
+    size_t nextBatch(size_t batchSize, BasicMatrix<T>& inputs, BasicMatrix<T>& outputs);
+
+    /**
+     * @brief Active ou désactive le mélange (pris en compte au prochain rewind)
+     */
+    void setShuffle(bool shuffle) { options_.shuffle = shuffle; }
+
+    const Options& getOptions() const { return options_; }
+    bool isOpen() const { return source_ != Source::None; }
+    size_t getNumInputs() const { return numInputs_; }
+    size_t getNumOutputs() const { return numOutputs_; }
+
+private:
+    enum class Source {
+        None,
+        CSV,
+        Binary
+    };
+
+    Options options_;
+    Source source_;
+    size_t numInputs_;
+    size_t numOutputs_;
+    std::mt19937 generator_;
+
+    // Source CSV
+    std::ifstream csvFile_;
+    bool hasHeader_;
+    std::string line_;          // Ligne courante (réutilisée)
+    size_t lineNumber_;         // Numéro de la ligne courante (messages d'erreur)
+    Matrix shardInputs_;        // Shard courant
+    Matrix shardOutputs_;
+    size_t shardRows_;          // Lignes valides dans le shard
+    size_t shardCursor_;        // Prochaine ligne du shard à consommer
+
+    // Source binaire
+    DatasetManager binary_;     // Fichier .nuid projeté
+    size_t binaryCursor_;       // Prochain échantillon à lire
+
+    // Tampon de mélange
+    Matrix poolInputs_;
+    Matrix poolOutputs_;
+    size_t poolSize_;           // Échantillons présents dans le tampon
+    bool exhausted_;            // Fin du fichier atteinte pour cette époque
+    bool shuffling_;            // Mélange actif pour l'époque en cours
+
+    /**
+     * @brief Lit le shard CSV suivant
+     * @return False en fin de fichier
+     */
+    bool readCSVShard();
+
+    /**
+     * @brief Fournit l'échantillon suivant du fichier (pointeurs valides
+     * jusqu'au prochain appel)
+     * @return False en fin de fichier
+     */
+    bool nextSourceRow(const double*& inputs, const double*& outputs);
+
+    /**
+     * @brief Copie l'échantillon suivant de l'époque (mélangé ou non)
+     * @return False en fin d'époque
+     */
+    template <typename T>
+    bool nextRow(T* inputs, T* outputs);
+};
+
+} // namespace NeuroUIT
+
+#endif // STREAMINGDATASET_H
@@ -4,6 +4,7 @@
 #include <string>
 #include <memory>
 #include "core/Network.h"
+#include "core/Precision.h"
 
 namespace NeuroUIT {
 
@@ -14,19 +15,38 @@ class Persistence {
 public:
     /**
      * @brief Sauvegarde un réseau dans un fichier .nui
+     * La précision du réseau (float ou double) est enregistrée dans le fichier
      * @param network Réseau à sauvegarder
      * @param filename Nom du fichier
      * @return True si la sauvegarde a réussi
      */
-    static bool saveNetwork(std::shared_ptr<Network> network, const std::string& filename);
+    template <typename T>
+    static bool saveNetwork(std::shared_ptr<BasicNetwork<T>> network, const std::string& filename);
     
     /**
-     * @brief Charge un réseau depuis un fichier .nui
+     * @brief Charge un réseau depuis un fichier .nui en double précision
+     * Un fichier enregistré en float est converti
      * @param filename Nom du fichier
      * @return Réseau chargé (nullptr en cas d'erreur)
      */
     static std::shared_ptr<Network> loadNetwork(const std::string& filename);
     
+    /**
+     * @brief Charge un réseau depuis un fichier .nui dans la précision demandée
+     * @param filename Nom du fichier
+     * @return Réseau chargé (nullptr en cas d'erreur)
+     */
+    template <typename T>
+    static std::shared_ptr<BasicNetwork<T>> loadNetworkAs(const std::string& filename);
+    
+    /**
+     * @brief Lit la précision enregistrée dans un fichier .nui
+     * Les fichiers de version 1 (sans précision) sont en double
+     * @param filename Nom du fichier
+     * @return Précision du fichier
+     */
+    static Precision readPrecision(const std::string& filename);
+    
     /**
      * @brief Exporte les résultats dans un fichier CSV
      * @param epochErrors Erreurs par époque
@@ -39,7 +59,7 @@ public:
     /**
      * @brief Version du format de fichier
      */
-    static constexpr int FILE_VERSION = 1;
+    static constexpr int FILE_VERSION = 2;
 
 private:
     /**
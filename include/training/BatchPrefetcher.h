@@ -0,0 +1,131 @@
+#ifndef BATCHPREFETCHER_H
+#define BATCHPREFETCHER_H
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "core/Matrix.h"
+#include "concurrency/SpscQueue.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief Compteurs d'attente du pipeline de préchargement
+ */
+struct PrefetchStats {
+    size_t computeStalls = 0;         // Lots attendus par le calcul (chargeur en retard)
+    double computeWaitSeconds = 0.0;  // Temps total d'attente du calcul
+    size_t loaderStalls = 0;          // Attentes du chargeur (aucun tampon libre)
+    double loaderWaitSeconds = 0.0;   // Temps total d'attente du chargeur
+};
+
+/**
+ * @brief Assemble les lots d'entraînement sur un thread chargeur
+ *
+ * Le chargeur remplit à l'avance un petit nombre de tampons de lot pendant
+ * que le thread de calcul entraîne le réseau sur le lot courant. Les tampons
+ * circulent par deux SpscQueue : les lots prêts vers le calcul, les tampons
+ * libérés vers le chargeur. Aucune allocation n'a lieu une fois les tampons
+ * dimensionnés par le premier lot.
+ *
+ * @tparam T Type scalaire des lots (celui du réseau)
+ */
+template <typename T>
+class BasicBatchPrefetcher {
+public:
+    using Matrix = BasicMatrix<T>;
+
+    /**
+     * @brief Tampon d'un lot (entrées et cibles, une ligne par échantillon)
+     * Un lot vide marque la fin d'une époque
+     */
+    struct Batch {
+        Matrix inputs;
+        Matrix targets;
+    };
+
+    /**
+     * @brief Prépare la source pour une époque (mélange, retour au début...)
+     */
+    using EpochStart = std::function<void(size_t epoch)>;
+
+    /**
+     * @brief Remplit le lot suivant de l'époque
+     * @return Nombre d'échantillons, 0 en fin d'époque
+     */
+    using BatchFill = std::function<size_t(Matrix& inputs, Matrix& targets)>;
+
+    /**
+     * @brief Constructeur
+     * @param depth Nombre de lots préparés à l'avance (au moins 1)
+     */
+    explicit BasicBatchPrefetcher(size_t depth);
+
+    /**
+     * @brief Arrête le chargeur s'il tourne encore
+     */
+    ~BasicBatchPrefetcher();
+
+    BasicBatchPrefetcher(const BasicBatchPrefetcher&) = delete;
+    BasicBatchPrefetcher& operator=(const BasicBatchPrefetcher&) = delete;
+
+    /**
+     * @brief Lance le thread chargeur pour numEpochs époques
+     * Les fonctions sont appelées uniquement depuis le thread chargeur
+     */
+    void start(size_t numEpochs, EpochStart epochStart, BatchFill fill);
+
+    /**
+     * @brief Attend le lot suivant (thread de calcul)
+     * @return Lot à rendre via release(), ou nullptr en fin d'époque
+     * @throws L'exception levée par la source sur le thread chargeur
+     */
+    const Batch* acquire();
+
+    /**
+     * @brief Rend un lot au chargeur une fois l'entraînement dessus terminé
+     */
+    void release(const Batch* batch);
+
+    /**
+     * @brief Interrompt le chargeur et attend la fin de son thread
+     */
+    void stop();
+
+    /**
+     * @brief Compteurs d'attente (à lire après stop() ou la dernière époque)
+     */
+    PrefetchStats getStats() const;
+
+private:
+    std::vector<Batch> batches_;        // Tampons de lot (depth + 1)
+    SpscQueue<Batch*> ready_;           // Chargeur -> calcul
+    SpscQueue<Batch*> free_;            // Calcul -> chargeur
+    std::thread loader_;
+    std::atomic<bool> cancelled_;       // Demande d'arrêt du chargeur
+    std::atomic<bool> finished_;        // Le chargeur a terminé (ou échoué)
+    std::exception_ptr loaderError_;    // Exception levée par la source
+
+    PrefetchStats computeStats_;        // Modifié par le thread de calcul
+    PrefetchStats loaderStats_;         // Modifié par le thread chargeur
+
+    /**
+     * @brief Boucle du thread chargeur
+     */
+    void run(size_t numEpochs, const EpochStart& epochStart, const BatchFill& fill);
+
+    /**
+     * @brief Attend un tampon libre (thread chargeur)
+     * @return nullptr si le pipeline est interrompu
+     */
+    Batch* waitForFreeBatch();
+};
+
+using BatchPrefetcher = BasicBatchPrefetcher<double>;
+using BatchPrefetcherF = BasicBatchPrefetcher<float>;
+
+} // namespace NeuroUIT
+
+#endif // BATCHPREFETCHER_H
@@ -0,0 +1,103 @@
+#ifndef DATAPARALLEL_H
+#define DATAPARALLEL_H
+
+#include <functional>
+#include <vector>
+#include "core/Network.h"
+#include "concurrency/ThreadPool.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief Calcul du gradient d'un lot réparti sur plusieurs cœurs
+ *
+ * Le lot est découpé en parts, traitées par les tâches d'un ThreadPool (le
+ * thread appelant participe) qui partagent le réseau en lecture. Chaque part
+ * possède une réplique : son workspace et son gradient (BasicGradients, buffer
+ * contigu). Pour un lot, chaque part calcule le gradient de ses lignes, lues
+ * directement dans le lot par une vue (aucune copie), puis les gradients sont réduits en arbre
+ * (r[0] += r[1], r[2] += r[3], puis r[0] += r[2]...) : chaque tâche réduit une
+ * tranche distincte du buffer, si bien que la réduction est elle aussi
+ * parallèle. Le gradient total est ensuite appliqué une seule fois au réseau
+ * par l'appelant.
+ *
+ * Le réseau ne doit pas être modifié pendant computeGradients ou computeError.
+ *
+ * @tparam T Type scalaire du réseau
+ */
+template <typename T>
+class BasicDataParallel {
+public:
+    using Network = BasicNetwork<T>;
+    using Matrix = BasicMatrix<T>;
+    using MatrixView = BasicMatrixView<T>;
+    using Workspace = BasicWorkspace<T>;
+    using Gradients = BasicGradients<T>;
+
+    /**
+     * @brief Constructeur
+     * @param pool Pool qui exécute les parts (doit survivre à l'objet)
+     * @param network Réseau dont les répliques prennent la forme
+     * @param numThreads Nombre de parts du lot (au moins 1)
+     * @param batchCapacity Taille de lot prévue (dimensionne les workspaces)
+     */
+    BasicDataParallel(ThreadPool& pool, const Network& network,
+                      size_t numThreads, size_t batchCapacity);
+
+    BasicDataParallel(const BasicDataParallel&) = delete;
+    BasicDataParallel& operator=(const BasicDataParallel&) = delete;
+
+    size_t getNumThreads() const { return replicas_.size(); }
+
+    /**
+     * @brief Calcule le gradient du lot entier, réparti entre les threads
+     * @param network Réseau (lu seulement)
+     * @param inputs Entrées du lot
+     * @param targets Cibles du lot
+     * @return Gradient total du lot (valide jusqu'au prochain appel)
+     */
+    const Gradients& computeGradients(const Network& network,
+                                      MatrixView inputs, MatrixView targets);
+
+    /**
+     * @brief Erreur quadratique moyenne du lot (propagation avant répartie)
+     * Moyenne sur les échantillons de l'erreur moyenne de chaque échantillon
+     */
+    double computeError(const Network& network, MatrixView inputs, MatrixView targets);
+
+private:
+    /**
+     * @brief Données propres à une part
+     */
+    struct Replica {
+        Workspace workspace;
+        Gradients gradients;
+        double error = 0.0;     // Somme des erreurs par échantillon de la part
+    };
+
+    using Job = std::function<void(size_t worker)>;
+
+    ThreadPool& pool_;
+    std::vector<Replica> replicas_;
+
+    /**
+     * @brief Exécute job(w) pour chaque part w, en parallèle, et attend la fin de tous
+     * @throws La première exception levée par une part
+     */
+    void run(const Job& job);
+
+    /**
+     * @brief Première ligne de la part worker dans un lot de numRows lignes
+     * La part worker couvre [shardBegin(worker), shardBegin(worker + 1))
+     */
+    size_t shardBegin(size_t worker, size_t numRows) const {
+        return worker * numRows / replicas_.size();
+    }
+};
+
+using DataParallel = BasicDataParallel<double>;
+using DataParallelF = BasicDataParallel<float>;
+
+} // namespace NeuroUIT
+
+#endif // DATAPARALLEL_H
@@ -0,0 +1,92 @@
+#ifndef EVALUATOR_H
+#define EVALUATOR_H
+
+#include <cstdint>
+#include <vector>
+#include "core/Network.h"
+#include "dataset/DatasetView.h"
+#include "concurrency/ThreadPool.h"
+
+namespace NeuroUIT {
+
+/**
+ * @brief Résultats complets d'une évaluation
+ */
+struct EvaluationResults {
+    std::vector<double> predictions;           // Sorties du réseau (échantillon par échantillon)
+    std::vector<double> actuals;                // Valeurs réelles, alignées sur predictions
+    std::vector<uint32_t> predictedClasses;    // Classe prédite par échantillon (classification)
+    std::vector<uint32_t> actualClasses;       // Classe réelle par échantillon (classification)
+    std::vector<std::vector<int>> confusionMatrix; // [prédite][réelle]
+    size_t numClasses = 0;                     // 0 en régression
+    double mse = 0.0;                          // Erreur quadratique moyenne
+    double mae = 0.0;                          // Erreur absolue moyenne
+    double r2 = 0.0;                           // Coefficient R²
+    double accuracy = 0.0;                     // Précision (classification)
+    double precision = 0.0;                    // Précision (classification)
+    double recall = 0.0;                        // Rappel (classification)
+    double f1Score = 0.0;                      // Score F1
+    bool isClassification = true;              // Type de problème
+};
+
+/**
+ * @brief Évalue un réseau sur un ensemble de test, en parallèle
+ *
+ * L'ensemble est découpé en tranches contiguës, une par thread du pool (appelant
+ * compris). Chaque tranche a son propre workspace et ses propres accumulateurs
+ * (matrice de confusion, sommes des erreurs, moyenne et variance des cibles) ;
+ * ils sont fusionnés dans l'ordre des tranches, donc le résultat ne dépend que
+ * du nombre de tranches. Les prédictions sont écrites directement à leur place
+ * finale. Sans pool, l'évaluation se fait sur le thread appelant.
+ *
+ * Le type de problème est déduit des cibles :
+ * - une sortie, cibles 0/1 : classification binaire (seuil 0.5) ;
+ * - plusieurs sorties en one-hot : classification multi-classe (argmax),
+ *   précision/rappel/F1 en moyenne macro sur les classes rencontrées ;
+ * - sinon : régression (sorties multiples évaluées ensemble).
+ *
+ * @tparam T Type scalaire du réseau évalué
+ */
+template <typename T>
+class BasicEvaluator {
+public:
+    using Network = BasicNetwork<T>;
+
+    /**
+     * @brief Nombre d'échantillons par appel à Network::forwardBatch
+     */
+    static constexpr size_t BATCH_SIZE = 256;
+
+    /**
+     * @brief Constructeur
+     * @param pool Pool de threads partagé (nullptr = évaluation séquentielle)
+     */
+    explicit BasicEvaluator(ThreadPool* pool = nullptr) : pool_(pool) {}
+
+    /**
+     * @brief Évalue le réseau sur tous les échantillons de la vue
+     * Le réseau n'est que lu (forwardBatch const) et ne doit pas être
+     * entraîné pendant l'évaluation
+     * @param network Réseau évalué
+     * @param testSet Échantillons de test
+     * @return Prédictions et métriques (vides si testSet est vide)
+     */
+    EvaluationResults evaluate(const Network& network, const DatasetView& testSet) const;
+
+    void setThreadPool(ThreadPool* pool) { pool_ = pool; }
+
+    /**
+     * @brief Nombre de tranches d'une évaluation
+     */
+    size_t getNumThreads() const { return pool_ ? pool_->getConcurrency() : 1; }
+
+private:
+    ThreadPool* pool_;
+};
+
+using Evaluator = BasicEvaluator<double>;
+using EvaluatorF = BasicEvaluator<float>;
+
+} // namespace NeuroUIT
+
+#endif // EVALUATOR_H
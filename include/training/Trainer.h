@@ -1,19 +1,76 @@
 #ifndef TRAINER_H
 #define TRAINER_H
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <functional>
+#include <cstdint>
 #include "core/Network.h"
-#include "dataset/DatasetManager.h"
+#include "dataset/DatasetView.h"
+#include "dataset/StreamingDataset.h"
+#include "training/BatchPrefetcher.h"
+#include "training/DataParallel.h"
 
 namespace NeuroUIT {
 
+/**
+ * @brief Répartition de l'entraînement entre plusieurs threads (numThreads > 1)
+ */
+enum class ParallelMode {
+    Synchronous,   // Chaque lot est réparti entre les threads, gradient réduit puis appliqué
+    Hogwild        // Chaque thread entraîne ses propres lots et met à jour les poids sans verrou
+};
+
+/**
+ * @brief Paramètres d'entraînement
+ */
+struct TrainingParams {
+    double learningRate = 0.01;      // Taux d'apprentissage
+    size_t numEpochs = 100;          // Nombre d'époques
+    size_t batchSize = 1;             // Taille du batch (1 = descente stochastique)
+    double momentum = 0.0;           // Facteur de momentum
+    bool shuffle = true;             // Mélanger les échantillons à chaque époque
+    size_t prefetchDepth = 2;        // Lots préparés à l'avance par un thread chargeur
+                                     // (0 = désactivé ; ignoré sur un seul cœur)
+    size_t numThreads = 1;           // Threads de calcul (0 = tout le pool ; plafonné
+                                     // au parallélisme du pool, 1 sans pool)
+    ParallelMode parallelMode = ParallelMode::Synchronous; // Hogwild : vues (DatasetView)
+                                     // uniquement ; momentum et prefetchDepth doivent
+                                     // valoir 0 (sinon train lève invalid_argument)
+};
+
+/**
+ * @brief Résultats d'entraînement
+ */
+struct TrainingResults {
+    std::vector<double> epochErrors;  // Erreur par époque
+    size_t epochsCompleted = 0;      // Nombre d'époques complétées
+    double finalError = 0.0;          // Erreur finale
+    bool stopped = false;             // True si arrêté par l'utilisateur
+    double samplesPerSecond = 0.0;    // Débit d'entraînement (échantillons traités / s)
+    PrefetchStats prefetch;           // Attentes du pipeline de préchargement
+};
+
 /**
  * @brief Gère l'entraînement du réseau de neurones
+ *
+ * @tparam T Type scalaire du réseau entraîné. Les échantillons restent en
+ * double dans le DatasetManager et sont convertis lors de l'assemblage des lots.
  */
-class Trainer {
+template <typename T>
+class BasicTrainer {
 public:
+    using TrainingParams = NeuroUIT::TrainingParams;
+    using TrainingResults = NeuroUIT::TrainingResults;
+    using Network = BasicNetwork<T>;
+    using Matrix = BasicMatrix<T>;
+    using MatrixView = BasicMatrixView<T>;
+    using Workspace = BasicWorkspace<T>;
+    using BatchPrefetcher = BasicBatchPrefetcher<T>;
+    using DataParallel = BasicDataParallel<T>;
+    
     /**
      * @brief Callback pour la progression de l'entraînement
      * @param epoch Époque actuelle
@@ -22,83 +79,218 @@ public:
     using ProgressCallback = std::function<void(size_t epoch, double error)>;
     
     /**
-     * @brief Paramètres d'entraînement
+     * @brief Nombre d'échantillons évalués par appel à Network::forwardBatch
      */
-    struct TrainingParams {
-        double learningRate = 0.01;      // Taux d'apprentissage
-        size_t numEpochs = 100;          // Nombre d'époques
-        size_t batchSize = 1;             // Taille du batch (1 = descente stochastique)
-        double momentum = 0.0;           // Facteur de momentum
-        bool shuffle = true;             // Mélanger les échantillons à chaque époque
-    };
+    static constexpr size_t EVAL_BATCH_SIZE = 256;
     
     /**
-     * @brief Résultats d'entraînement
+     * @brief Lignes minimales par thread pour répartir un lot entre plusieurs
+     * threads ; en dessous, la synchronisation coûte plus que le calcul
      */
-    struct TrainingResults {
-        std::vector<double> epochErrors;  // Erreur par époque
-        size_t epochsCompleted = 0;      // Nombre d'époques complétées
-        double finalError = 0.0;          // Erreur finale
-        bool stopped = false;             // True si arrêté par l'utilisateur
-    };
+    static constexpr size_t MIN_ROWS_PER_THREAD = 16;
+    
+    /**
+     * @brief Lots traités par chaque part d'une époque Hogwild entre deux
+     * vérifications de la pause par le thread appelant
+     */
+    static constexpr size_t HOGWILD_ROUND_BATCHES = 16;
     
     /**
      * @brief Constructeur
      * @param network Réseau à entraîner
      */
-    Trainer(std::shared_ptr<Network> network);
+    BasicTrainer(std::shared_ptr<Network> network);
+    
+    /**
+     * @brief Pool de threads des modes parallèles (nullptr = entraînement sur le thread appelant)
+     * Le pool doit survivre au Trainer ; à ne pas changer pendant un entraînement
+     */
+    void setThreadPool(ThreadPool* pool) { threadPool_ = pool; }
     
     /**
      * @brief Entraîne le réseau sur les données fournies
-     * @param trainSamples Échantillons d'entraînement
+     * @param trainSet Vue sur les échantillons d'entraînement
      * @param params Paramètres d'entraînement
      * @param callback Callback appelé à chaque époque
      * @return Résultats d'entraînement
+     * @throws std::invalid_argument Mode Hogwild avec momentum ou préchargement
      */
-    TrainingResults train(const std::vector<DatasetManager::Sample>& trainSamples,
+    TrainingResults train(const DatasetView& trainSet,
+                         const TrainingParams& params,
+                         ProgressCallback callback = nullptr);
+    
+    /**
+     * @brief Entraîne le réseau sur une source lue en flux
+     * Chaque époque relit la source depuis le début ; params.shuffle active
+     * le mélange dans le tampon de la source
+     * @param dataset Source ouverte (CSV ou .nuid)
+     * @param params Paramètres d'entraînement
+     * @param callback Callback appelé à chaque époque
+     * @return Résultats d'entraînement
+     * @throws std::invalid_argument Mode Hogwild (réservé aux DatasetView)
+     */
+    TrainingResults train(StreamingDataset& dataset,
                          const TrainingParams& params,
                          ProgressCallback callback = nullptr);
     
     /**
      * @brief Teste le réseau sur des échantillons de test
-     * @param testSamples Échantillons de test
+     * @param testSet Vue sur les échantillons de test
      * @return Erreur moyenne
      */
-    double test(const std::vector<DatasetManager::Sample>& testSamples);
+    double test(const DatasetView& testSet);
     
     /**
      * @brief Arrête l'entraînement en cours (thread-safe)
      */
     void stop();
     
+    /**
+     * @brief Suspend l'entraînement à la fin du lot courant (thread-safe)
+     */
+    void pause();
+    
+    /**
+     * @brief Reprend un entraînement suspendu (thread-safe)
+     */
+    void resume();
+    
     /**
      * @brief Vérifie si l'entraînement est en cours
      */
-    bool isTraining() const { return isTraining_; }
+    bool isTraining() const { return isTraining_.load(std::memory_order_acquire); }
+    
+    /**
+     * @brief Vérifie si l'entraînement est suspendu
+     */
+    bool isPaused() const { return isPaused_.load(std::memory_order_acquire); }
 
 private:
+    /**
+     * @brief Intervalle de vérification de la reprise pendant une pause
+     */
+    static constexpr std::chrono::milliseconds PAUSE_POLL_INTERVAL{10};
+    
     std::shared_ptr<Network> network_;
-    bool isTraining_;
-    bool shouldStop_;
+    std::atomic<bool> isTraining_;
+    std::atomic<bool> shouldStop_;   // Demande d'arrêt (autre thread)
+    std::atomic<bool> isPaused_;     // Pause demandée (autre thread)
+    Matrix batchInputs_;   // Entrées du batch courant (réutilisé entre batches)
+    Matrix batchTargets_;  // Cibles du batch courant
+    Workspace evalWorkspace_; // Buffers des forwardBatch d'évaluation
+    ThreadPool* threadPool_;   // Pool des modes parallèles (non possédé)
+    std::unique_ptr<DataParallel> dataParallel_; // Répliques du calcul réparti (params.numThreads > 1)
+    size_t samplesProcessed_;  // Échantillons traités depuis le début de l'entraînement
+    
+    /**
+     * @brief Entraîne le réseau à partir d'une source de lots
+     * Avec params.prefetchDepth > 0, les lots sont assemblés sur un thread
+     * chargeur pendant le calcul ; sinon les deux alternent sur le thread appelant
+     * @param params Paramètres d'entraînement
+     * @param callback Callback appelé à chaque époque
+     * @param epochStart Préparation de la source au début de chaque époque
+     * @param fill Remplissage du lot suivant (0 en fin d'époque)
+     */
+    TrainingResults runTraining(const TrainingParams& params,
+                                ProgressCallback callback,
+                                typename BatchPrefetcher::EpochStart epochStart,
+                                typename BatchPrefetcher::BatchFill fill);
     
     /**
-     * @brief Entraîne une époque
-     * @param trainSamples Échantillons d'entraînement
+     * @brief Boucle commune des époques (progression, arrêt, résultats)
+     * @param params Paramètres d'entraînement
+     * @param callback Callback appelé à chaque époque
+     * @param trainOneEpoch Fonction entraînant une époque et renvoyant son erreur
+     */
+    template <typename EpochFunction>
+    TrainingResults runEpochs(const TrainingParams& params,
+                              ProgressCallback callback,
+                              EpochFunction trainOneEpoch);
+    
+    /**
+     * @brief Entraîne une époque en assemblant les lots sur le thread appelant
+     * @param fill Remplissage du lot suivant (0 en fin d'époque)
      * @param params Paramètres d'entraînement
      * @return Erreur moyenne sur l'époque
      */
-    double trainEpoch(const std::vector<DatasetManager::Sample>& trainSamples,
-                     const TrainingParams& params);
+    double trainEpoch(const typename BatchPrefetcher::BatchFill& fill,
+                      const TrainingParams& params);
     
     /**
-     * @brief Traite un batch
-     * @param batchSamples Échantillons du batch
+     * @brief Entraîne une époque sur les lots fournis par le thread chargeur
+     * @param prefetcher Pipeline de préchargement démarré
      * @param params Paramètres d'entraînement
+     * @return Erreur moyenne sur l'époque
      */
-    void processBatch(const std::vector<DatasetManager::Sample>& batchSamples,
-                     const TrainingParams& params);
+    double trainEpoch(BatchPrefetcher& prefetcher, const TrainingParams& params);
+    
+    /**
+     * @brief Entraîne une époque en mode Hogwild
+     *
+     * L'ordre de l'époque est découpé en une part contiguë par tâche du pool.
+     * Chaque tâche assemble ses lots, calcule leur gradient sur le réseau
+     * partagé et l'applique aussitôt (Network::applyGradients), sans attendre
+     * les autres. Les parts avancent par tours de HOGWILD_ROUND_BATCHES lots :
+     * entre deux tours, le thread appelant attend la fin d'une pause ; un
+     * arrêt est pris en compte par chaque tâche dès la fin de son lot.
+     *
+     * @param dataset Dataset des échantillons
+     * @param order Indices des échantillons dans l'ordre de l'époque
+     * @param params Paramètres d'entraînement
+     * @param numThreads Nombre de parts (thread appelant compris)
+     * @return Erreur moyenne des lots, chacune mesurée après la mise à jour
+     *         de son lot (comme trainPackedBatch)
+     */
+    double trainEpochHogwild(const DatasetManager& dataset, Span<const uint32_t> order,
+                             const TrainingParams& params, size_t numThreads);
+    
+    /**
+     * @brief Met à jour le réseau sur un lot assemblé
+     * Le gradient est réparti entre les threads de dataParallel_ si le lot est assez grand
+     * @param inputs Entrées du lot (une ligne par échantillon)
+     * @param targets Cibles du lot
+     * @param params Paramètres d'entraînement
+     * @return Erreur moyenne du lot après mise à jour
+     */
+    double trainPackedBatch(const Matrix& inputs, const Matrix& targets,
+                            const TrainingParams& params);
+    
+    /**
+     * @brief Bloque le thread d'entraînement tant que la pause est active
+     * @return False si l'arrêt a été demandé
+     */
+    bool waitWhilePaused();
+    
+    /**
+     * @brief Nombre de threads de calcul : params.numThreads (0 = tout le pool),
+     * plafonné au parallélisme du pool (1 sans pool)
+     */
+    size_t resolveNumThreads(const TrainingParams& params) const;
+    
+    /**
+     * @brief Recrée le workspace d'évaluation si l'architecture du réseau a changé
+     */
+    void prepareEvalWorkspace(size_t batchCapacity);
+    
+    /**
+     * @brief Erreur quadratique moyenne d'une ligne de prédictions
+     * @param prediction Sorties du réseau pour un échantillon
+     * @param targets Valeurs cibles
+     */
+    template <typename U>
+    static double computeRowError(const T* prediction, Span<const U> targets);
+    
+    /**
+     * @brief Erreur d'un lot : moyenne des erreurs de ses lignes
+     * @param predictions Sorties du réseau (une ligne par échantillon)
+     * @param targets Valeurs cibles du lot
+     */
+    static double computeBatchError(MatrixView predictions, MatrixView targets);
 };
 
+using Trainer = BasicTrainer<double>;
+using TrainerF = BasicTrainer<float>;
+
 } // namespace NeuroUIT
 
 #endif // TRAINER_H
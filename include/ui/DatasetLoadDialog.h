@@ -22,10 +22,12 @@ struct DatasetLoadConfig {
     size_t numInputs;
     size_t numOutputs;
     bool hasHeader;
+    bool useCache;      // Conserver une copie binaire dans le cache de l'application
 };
 
 /**
- * @brief Dialog pour charger un dataset CSV
+ * @brief Dialog pour charger un dataset CSV ou binaire (.nuid)
+ * Pour un fichier .nuid, les dimensions sont lues dans le fichier
  */
 class DatasetLoadDialog : public QDialog {
     Q_OBJECT
@@ -49,6 +51,7 @@ private:
     QSpinBox* numInputsSpinBox_;
     QSpinBox* numOutputsSpinBox_;
     QCheckBox* hasHeaderCheckBox_;
+    QCheckBox* useCacheCheckBox_;
 };
 
 } // namespace NeuroUIT
@@ -3,23 +3,58 @@
 
 #include <QWidget>
 #include <QPaintEvent>
+#include <QPixmap>
 #include <vector>
 #include <algorithm>
 
+class QContextMenuEvent;
+class QResizeEvent;
+
 /**
  * @brief Widget pour afficher le graphique d'évolution de l'erreur
+ *
+ * Les erreurs sont regroupées en intervalles d'époques consécutives (au plus
+ * un par pixel de largeur) dont on garde la première, la dernière, la plus
+ * petite et la plus grande valeur : chaque intervalle est dessiné comme un
+ * segment vertical min/max, ce qui conserve les pics. Le coût d'un repaint
+ * dépend donc de la largeur du widget, pas du nombre d'époques.
+ *
+ * Les intervalles complets sont dessinés une seule fois dans un pixmap ; seuls
+ * les nouveaux sont ajoutés ensuite. Le pixmap est redessiné entièrement quand
+ * les échelles changent (redimensionnement, fusion des intervalles, valeur
+ * hors de l'échelle Y, bascule linéaire/logarithmique).
  */
 class ErrorChartWidget : public QWidget {
     Q_OBJECT
 
 public:
     explicit ErrorChartWidget(QWidget *parent = nullptr);
-    
+
     /**
      * @brief Ajoute un point de données (époque, erreur)
      */
     void addDataPoint(size_t epoch, double error);
-    
+
+    /**
+     * @brief Ajoute les erreurs d'époques consécutives (un seul repaint)
+     * @param firstEpoch Époque de errors[0]
+     * @param errors Erreurs des époques firstEpoch, firstEpoch + 1...
+     */
+    void addDataPoints(size_t firstEpoch, const std::vector<double>& errors);
+
+    /**
+     * @brief Fixe l'étendue de l'axe des époques (0 = s'adapter aux données)
+     * Avec le nombre d'époques prévu, l'axe X ne change plus pendant
+     * l'entraînement et seuls les nouveaux points sont dessinés
+     */
+    void setEpochRange(size_t numEpochs);
+
+    /**
+     * @brief Active l'échelle logarithmique sur l'axe des erreurs
+     */
+    void setLogScale(bool enabled);
+    bool isLogScale() const { return logScale_; }
+
     /**
      * @brief Vide le graphique
      */
@@ -27,16 +62,62 @@ public:
 
 protected:
     void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void contextMenuEvent(QContextMenuEvent* event) override;
 
 private:
-    void drawChart(QPainter& painter);
-    
-    std::vector<double> epochErrors_;
-    
+    /**
+     * @brief Résumé d'un intervalle d'époques consécutives
+     */
+    struct Bucket {
+        double first = 0.0;
+        double last = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+        size_t count = 0;   // Époques connues (les époques manquantes sont ignorées)
+    };
+
+    void drawAxes(QPainter& painter);
+    void drawBuckets(QPainter& painter, size_t begin, size_t end);
+
+    /**
+     * @brief Enregistre une erreur ; false si une époque existante a été modifiée
+     */
+    bool storeValue(size_t epoch, double error);
+    void appendToBuckets(size_t epoch, double error);
+    void mergeBuckets();
+    void rebuildBuckets();
+    void includeInRange(double error);
+
+    size_t bucketCapacity() const;
+    size_t completedBuckets() const;
+    size_t xSpan() const;
+    double toAxis(double error) const;
+    double xPosition(size_t bucket) const;
+    double yPosition(double error) const;
+    void invalidateCache() { cacheValid_ = false; }
+
+    std::vector<double> epochErrors_;   // Toutes les erreurs (NaN = époque manquante)
+    std::vector<Bucket> buckets_;       // Série réduite, bucketSize_ époques par intervalle
+    size_t bucketSize_;
+    size_t expectedEpochs_;             // Étendue de l'axe X (0 = données)
+
+    bool logScale_;
+    bool rangeValid_;
+    double axisLow_;                    // Bornes de l'axe Y (log10 en échelle log)
+    double axisHigh_;
+
+    QPixmap cache_;                     // Axes + intervalles déjà dessinés
+    bool cacheValid_;
+    size_t cachedBuckets_;              // Intervalles présents dans cache_
+    size_t cachedXSpan_;
+
     static constexpr int MARGIN = 50;
     static constexpr int BOTTOM_MARGIN = 40;
     static constexpr int LEFT_MARGIN = 60;
+    static constexpr size_t MIN_BUCKETS = 16;
+    static constexpr double MIN_DOT_SPACING = 6.0;   // Pixels entre époques pour dessiner les points
+    static constexpr double LOG_FLOOR = 1e-12;       // Plus petite erreur représentable en log
 };
 
 #endif // ERRORCHARTWIDGET_H
-
@@ -9,6 +9,7 @@
 #include <QPushButton>
 #include <QLabel>
 #include <QTextEdit>
+#include <QPlainTextEdit>
 #include <QSplitter>
 #include <QGroupBox>
 #include <QProgressBar>
@@ -17,6 +18,7 @@
 #include <QActionGroup>
 #include <QStyle>
 #include <memory>
+#include <vector>
 
 class QTabWidget;
 
@@ -54,15 +56,18 @@ private slots:
     void onLoadNetwork();
     void onSaveNetwork();
     void onLoadDataset();
+    void onClearDatasetCache();
     void onStartTraining();
     void onStopTraining();
+    void onPauseTraining();
     void onTestNetwork();
     void onExportResults();
     void onHelp();
     void onAbout();
 
-    void onTrainingProgress(size_t epoch, double error);
+    void onTrainingProgress(size_t firstEpoch, const std::vector<double>& errors);
     void onTrainingFinished();
+    void onTrainingFailed(const QString& message);
     void onNetworkCreated();
     void onDatasetLoaded();
 
@@ -81,6 +86,9 @@ private:
     void applyTheme(bool darkMode);
     void showNotification(const QString& message, bool isError = false);
     
+    // Lignes conservées dans les logs (les plus anciennes sont supprimées)
+    static constexpr int LOG_MAX_LINES = 2000;
+    
     // Contrôleur
     std::shared_ptr<NeuroUIT::Controller> controller_;
     
@@ -103,7 +111,7 @@ private:
     PredictionsChartWidget* predictionsChartWidget_;
     StatisticsWidget* statisticsWidget_;
     ResultsDashboardWidget* resultsDashboardWidget_;
-    QTextEdit* logTextEdit_;
+    QPlainTextEdit* logTextEdit_;
     QTextEdit* configTextEdit_;
     
     // Boutons
@@ -111,6 +119,7 @@ private:
     QPushButton* btnLoadDataset_;
     QPushButton* btnStartTraining_;
     QPushButton* btnStopTraining_;
+    QPushButton* btnPauseTraining_;
     QPushButton* btnTestNetwork_;
     QPushButton* btnWizard_;
     
@@ -7,7 +7,8 @@
 #include <memory>
 
 namespace NeuroUIT {
-    class Network;
+    template <typename T> class BasicNetwork;
+    using Network = BasicNetwork<double>;
 }
 
 /**
@@ -6,7 +6,7 @@
 #include <QHBoxLayout>
 #include <QGridLayout>
 #include <QLabel>
-#include <QTableWidget>
+#include <QTableView>
 #include <QGroupBox>
 #include <QScrollArea>
 #include <QProgressBar>
@@ -16,6 +16,8 @@ namespace NeuroUIT {
     class Controller;
 }
 
+class TestResultsTableModel;
+
 /**
  * @brief Widget principal pour afficher le dashboard de résultats
  */
@@ -70,11 +72,13 @@ private:
     
     // Résultats de classification
     QGroupBox* classificationResultsGroup_;
-    QTableWidget* classificationTable_;
+    QTableView* classificationTable_;
+    TestResultsTableModel* classificationModel_;
     
     // Résultats de régression
     QGroupBox* regressionResultsGroup_;
-    QTableWidget* regressionTable_;
+    QTableView* regressionTable_;
+    TestResultsTableModel* regressionModel_;
     
     // Historique d'entraînement
     QGroupBox* trainingHistoryGroup_;
@@ -0,0 +1,81 @@
+#ifndef TESTRESULTSTABLEMODEL_H
+#define TESTRESULTSTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Modèle de tableau sur les prédictions d'un test
+ *
+ * Les cellules sont calculées à la demande dans data() à partir des tableaux
+ * de prédictions et de valeurs réelles : la vue ne matérialise que les lignes
+ * visibles, quel que soit le nombre d'échantillons. Le tri ne déplace pas les
+ * données ; il calcule une permutation des lignes (4 octets par ligne).
+ */
+class TestResultsTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Colonnes affichées selon le type de problème
+     */
+    enum class Mode {
+        Classification,   // Échantillon, Classe réelle, Classe prédite, Statut (indices de classe)
+        Regression        // Échantillon, Valeur réelle, Prédiction, Erreur, Erreur %
+    };
+    
+    explicit TestResultsTableModel(Mode mode, QObject *parent = nullptr);
+    
+    /**
+     * @brief Remplace les résultats affichés (les tableaux sont déplacés, pas copiés)
+     * Le tri courant est conservé
+     * @param predictions Prédictions du réseau
+     * @param actuals Valeurs réelles correspondantes
+     */
+    void setResults(std::vector<double> predictions, std::vector<double> actuals);
+    
+    /**
+     * @brief Vide le modèle
+     */
+    void clear();
+    
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+    
+    /**
+     * @brief Trie les lignes ; les colonnes d'erreur et de statut sont
+     * triées par amplitude de l'erreur
+     */
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+private:
+    /**
+     * @brief Échantillon affiché à une ligne (selon le tri courant)
+     */
+    size_t sampleAt(int row) const {
+        return order_.empty() ? static_cast<size_t>(row) : order_[row];
+    }
+    
+    /**
+     * @brief Clé de tri d'un échantillon pour une colonne
+     */
+    double sortKey(size_t sample, int column) const;
+    
+    /**
+     * @brief Recalcule order_ selon le tri courant
+     */
+    void buildOrder();
+    
+    Mode mode_;
+    int sortColumn_;                // Tri courant, réappliqué aux nouveaux résultats
+    Qt::SortOrder sortOrder_;
+    std::vector<double> predictions_;
+    std::vector<double> actuals_;
+    std::vector<uint32_t> order_;   // Permutation des lignes (vide = ordre des échantillons)
+};
+
+#endif // TESTRESULTSTABLEMODEL_H
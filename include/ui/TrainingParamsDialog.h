@@ -5,6 +5,7 @@
 #include <QDoubleSpinBox>
 #include <QSpinBox>
 #include <QCheckBox>
+#include <QComboBox>
 #include <QFormLayout>
 #include "training/Trainer.h"
 
@@ -31,6 +32,8 @@ private:
     QSpinBox* numEpochsSpinBox_;
     QSpinBox* batchSizeSpinBox_;
     QDoubleSpinBox* momentumSpinBox_;
+    QSpinBox* numThreadsSpinBox_;
+    QComboBox* parallelModeComboBox_;
     QCheckBox* shuffleCheckBox_;
 };
 
@@ -0,0 +1,280 @@
+#include "concurrency/ThreadPool.h"
+#include <chrono>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace NeuroUIT {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Thread de travail courant : pool d'appartenance et indice dans ce pool
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local size_t currentIndex = 0;
+
+uint64_t nanosecondsSince(Clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+/**
+ * @brief Fixe un thread sur un cœur (sans effet hors Linux)
+ */
+void pinToCore(std::thread& thread, size_t core) {
+#if defined(__linux__)
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(core % CPU_SETSIZE, &cpus);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus);
+#else
+    (void)thread;
+    (void)core;
+#endif
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(const Options& options)
+    : options_(options)
+    , queuedTasks_(0)
+    , stopping_(false)
+{
+    size_t numCores = std::max(1u, std::thread::hardware_concurrency());
+    size_t numThreads = options_.numThreads;
+    if (numThreads == 0) {
+        // Sur un seul cœur : aucun thread, l'appelant exécute tout dans TaskGroup::wait
+        numThreads = numCores - 1;
+    }
+    options_.numThreads = numThreads;
+
+    // Tous les Worker existent avant le démarrage du premier thread (vol)
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers_[i]->thread = std::thread(&ThreadPool::workerLoop, this, i);
+        if (options_.pinThreads) {
+            pinToCore(workers_[i]->thread, i % numCores);
+        }
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    wakeCondition_.notify_all();
+    for (auto& worker : workers_) {
+        worker->thread.join();
+    }
+}
+
+size_t ThreadPool::currentWorker() const {
+    return currentPool == this ? currentIndex : workers_.size();
+}
+
+void ThreadPool::submit(Job job) {
+    // Compté avant la mise en file : un thread réveillé trouve la tâche peu après
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        queuedTasks_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    size_t self = currentWorker();
+    if (self < workers_.size()) {
+        std::lock_guard<std::mutex> lock(workers_[self]->mutex);
+        workers_[self]->tasks.push_back(std::move(job));
+    } else {
+        std::lock_guard<std::mutex> lock(injectionMutex_);
+        injected_.push_back(std::move(job));
+    }
+    wakeCondition_.notify_one();
+}
+
+bool ThreadPool::popTask(size_t self, Job& job, bool& stolen) {
+    stolen = false;
+
+    // 1. Sa propre file, par la fin (tâche la plus récente)
+    if (self < workers_.size()) {
+        Worker& worker = *workers_[self];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty()) {
+            job = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+            queuedTasks_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // 2. Tâches soumises de l'extérieur
+    {
+        std::lock_guard<std::mutex> lock(injectionMutex_);
+        if (!injected_.empty()) {
+            job = std::move(injected_.front());
+            injected_.pop_front();
+            queuedTasks_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // 3. Vol, par le début (tâche la plus ancienne), en partant du voisin
+    size_t numWorkers = workers_.size();
+    for (size_t k = 1; k <= numWorkers; ++k) {
+        size_t victim = (self + k) % numWorkers;
+        if (victim == self) {
+            continue;
+        }
+        Worker& worker = *workers_[victim];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty()) {
+            job = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+            queuedTasks_.fetch_sub(1, std::memory_order_relaxed);
+            stolen = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::execute(Job& job) {
+    std::exception_ptr error;
+    try {
+        job.task();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    // Libérer les captures avant de signaler la fin : le groupe peut disparaître ensuite
+    job.task = nullptr;
+    job.group->finish(error);
+}
+
+bool ThreadPool::tryRunPendingTask() {
+    Job job;
+    bool stolen;
+    size_t self = currentWorker();
+    if (!popTask(self, job, stolen)) {
+        return false;
+    }
+
+    if (self < workers_.size()) {
+        Worker& worker = *workers_[self];
+        Clock::time_point start = Clock::now();
+        execute(job);
+        worker.busyNanoseconds.fetch_add(nanosecondsSince(start), std::memory_order_relaxed);
+        worker.tasksExecuted.fetch_add(1, std::memory_order_relaxed);
+        worker.tasksStolen.fetch_add(stolen ? 1 : 0, std::memory_order_relaxed);
+    } else {
+        execute(job);
+    }
+    return true;
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentIndex = index;
+    Worker& worker = *workers_[index];
+
+    while (true) {
+        if (tryRunPendingTask()) {
+            continue;
+        }
+
+        Clock::time_point start = Clock::now();
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wakeCondition_.wait(lock, [this] {
+            return stopping_ || queuedTasks_.load(std::memory_order_relaxed) > 0;
+        });
+        worker.idleNanoseconds.fetch_add(nanosecondsSince(start), std::memory_order_relaxed);
+        if (stopping_ && queuedTasks_.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+    }
+}
+
+std::vector<ThreadPool::WorkerStats> ThreadPool::getStats() const {
+    std::vector<WorkerStats> stats(workers_.size());
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        const Worker& worker = *workers_[i];
+        stats[i].tasksExecuted = worker.tasksExecuted.load(std::memory_order_relaxed);
+        stats[i].tasksStolen = worker.tasksStolen.load(std::memory_order_relaxed);
+        stats[i].busySeconds = worker.busyNanoseconds.load(std::memory_order_relaxed) * 1e-9;
+        stats[i].idleSeconds = worker.idleNanoseconds.load(std::memory_order_relaxed) * 1e-9;
+    }
+    return stats;
+}
+
+void ThreadPool::resetStats() {
+    for (auto& worker : workers_) {
+        worker->tasksExecuted.store(0, std::memory_order_relaxed);
+        worker->tasksStolen.store(0, std::memory_order_relaxed);
+        worker->busyNanoseconds.store(0, std::memory_order_relaxed);
+        worker->idleNanoseconds.store(0, std::memory_order_relaxed);
+    }
+}
+
+TaskGroup::~TaskGroup() {
+    try {
+        wait();
+    } catch (...) {
+        // Exception déjà perdue pour l'appelant (destruction pendant une autre exception)
+    }
+}
+
+void TaskGroup::run(ThreadPool::Task task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++pending_;
+    }
+    ThreadPool::Job job;
+    job.task = std::move(task);
+    job.group = this;
+    pool_.submit(std::move(job));
+}
+
+void TaskGroup::finish(std::exception_ptr error) {
+    // Tout sous le verrou : dès que wait() voit pending_ == 0, le groupe peut être détruit
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (error && !error_) {
+        error_ = error;
+    }
+    if (--pending_ == 0) {
+        doneCondition_.notify_all();
+    }
+}
+
+void TaskGroup::wait() {
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_ == 0) {
+                break;
+            }
+        }
+        // Aider tant qu'il reste du travail en file, puis attendre les tâches en cours.
+        // Une tâche en cours qui en crée d'autres réveille les threads du pool.
+        if (!pool_.tryRunPendingTask()) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            doneCondition_.wait(lock, [this] { return pending_ == 0; });
+            break;
+        }
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error = error_;
+        error_ = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace NeuroUIT
@@ -1,28 +1,54 @@
 #include "controller/Controller.h"
-#include <QThread>
+#include <QTimer>
+#include <QStandardPaths>
+#include <QCryptographicHash>
 #include <memory>
 #include <algorithm>
 #include <cmath>
-#include <numeric>
+#include <filesystem>
 
 namespace NeuroUIT {
 
 Controller::Controller(QObject* parent)
     : QObject(parent)
+    , threadPool_(std::make_unique<ThreadPool>())
+    , evaluator_(threadPool_.get())
+    , datasetVersion_(0)
+    , testResultsValid_(false)
+    , testResultsNetworkVersion_(0)
+    , testResultsDatasetVersion_(0)
+    , correlationValid_(false)
+    , correlationDatasetVersion_(0)
+    , progressQueue_(PROGRESS_QUEUE_CAPACITY)
+    , trainingDone_(false)
+    , progressTimer_(new QTimer(this))
 {
+    splitOptions_.trainRatio = 0.7;
+    datasetManager_.setThreadPool(threadPool_.get());
+    
+    progressTimer_->setInterval(PROGRESS_DRAIN_INTERVAL_MS);
+    connect(progressTimer_, &QTimer::timeout, this, &Controller::drainTrainingProgress);
 }
 
 Controller::~Controller() {
     if (trainer_) {
         trainer_->stop();
     }
+    if (trainingThread_.joinable()) {
+        trainingThread_.join();
+    }
 }
 
 bool Controller::createNetwork(const std::vector<size_t>& architecture,
                               const std::vector<ActivationType>& activations) {
+    if (isTraining()) {
+        return false;
+    }
+    
     try {
         network_ = std::make_shared<Network>(architecture, activations);
         network_->initializeWeights();
+        invalidateEvaluationCache();
         initializeTrainer();
         emit networkCreated();
         return true;
@@ -32,7 +58,12 @@ bool Controller::createNetwork(const std::vector<size_t>& architecture,
 }
 
 bool Controller::loadNetwork(const std::string& filename) {
+    if (isTraining()) {
+        return false;
+    }
+    
     network_ = Persistence::loadNetwork(filename);
+    invalidateEvaluationCache();
     if (network_) {
         initializeTrainer();
         emit networkCreated();
@@ -42,7 +73,7 @@ bool Controller::loadNetwork(const std::string& filename) {
 }
 
 bool Controller::saveNetwork(const std::string& filename) {
-    if (!network_) {
+    if (!network_ || isTraining()) {
         return false;
     }
     return Persistence::saveNetwork(network_, filename);
@@ -51,40 +82,165 @@ bool Controller::saveNetwork(const std::string& filename) {
 bool Controller::loadDataset(const std::string& filename,
                              size_t numInputs,
                              size_t numOutputs,
-                             bool hasHeader) {
-    bool success = datasetManager_.loadFromCSV(filename, numInputs, numOutputs, hasHeader);
+                             bool hasHeader,
+                             bool useCache) {
+    if (isTraining()) {
+        return false;
+    }
+    
+    // Les vues train/test pointent sur les données du chargement précédent
+    trainSet_ = DatasetView();
+    validationSet_ = DatasetView();
+    testSet_ = DatasetView();
+    ++datasetVersion_;
+    
+    bool success;
+    if (std::filesystem::path(filename).extension() == DatasetManager::BINARY_EXTENSION) {
+        success = datasetManager_.loadFromBinary(filename);
+    } else if (useCache) {
+        success = loadCSVWithCache(filename, numInputs, numOutputs, hasHeader);
+    } else {
+        success = datasetManager_.loadFromCSV(filename, numInputs, numOutputs, hasHeader);
+    }
     if (success) {
-        // Séparer train/test
-        auto [train, test] = datasetManager_.splitTrainTest(0.7);
-        trainSamples_ = train;
-        testSamples_ = test;
+        splitDataset();
         emit datasetLoaded();
     }
     return success;
 }
 
-void Controller::startTraining(const Trainer::TrainingParams& params) {
-    if (!network_ || trainSamples_.empty()) {
-        return;
+bool Controller::loadCSVWithCache(const std::string& filename,
+                                  size_t numInputs,
+                                  size_t numOutputs,
+                                  bool hasHeader) {
+    std::string directory = getDatasetCacheDirectory();
+    std::error_code error;
+    auto csvTime = std::filesystem::last_write_time(filename, error);
+    uintmax_t csvSize = error ? 0 : std::filesystem::file_size(filename, error);
+    if (directory.empty() || error) {
+        return datasetManager_.loadFromCSV(filename, numInputs, numOutputs, hasHeader);
+    }
+    
+    // Clé : chemin, date et taille du CSV ; un CSV modifié change de clé
+    std::string prefix = cachePrefix(filename);
+    std::string key = prefix + std::to_string(csvTime.time_since_epoch().count())
+                    + "-" + std::to_string(csvSize);
+    std::filesystem::path cacheFile =
+        std::filesystem::path(directory) / (key + DatasetManager::BINARY_EXTENSION);
+    
+    if (std::filesystem::exists(cacheFile, error) &&
+        datasetManager_.loadFromBinary(cacheFile.string())) {
+        if (datasetManager_.getNumInputs() == numInputs &&
+            datasetManager_.getNumOutputs() == numOutputs &&
+            datasetManager_.getColumnNames().empty() != hasHeader) {
+            return true;
+        }
+        datasetManager_.clear();
+    }
+    
+    if (!datasetManager_.loadFromCSV(filename, numInputs, numOutputs, hasHeader)) {
+        return false;
+    }
+    
+    // Un seul cache par CSV : retirer ceux des versions précédentes du fichier
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.path().filename().string().compare(0, prefix.size(), prefix) == 0) {
+            std::filesystem::remove(entry.path(), error);
+        }
+    }
+    
+    // Un cache impossible à écrire (disque plein...) n'est pas une erreur
+    datasetManager_.saveToBinary(cacheFile.string());
+    return true;
+}
+
+std::string Controller::getDatasetCacheDirectory() {
+    QString location = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (location.isEmpty()) {
+        return std::string();
+    }
+    std::filesystem::path directory = std::filesystem::path(location.toStdString()) / "datasets";
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    return error ? std::string() : directory.string();
+}
+
+size_t Controller::clearDatasetCache() {
+    std::string directory = getDatasetCacheDirectory();
+    if (directory.empty()) {
+        return 0;
+    }
+    
+    size_t removed = 0;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.path().extension() == DatasetManager::BINARY_EXTENSION &&
+            std::filesystem::remove(entry.path(), error)) {
+            ++removed;
+        }
+    }
+    return removed;
+}
+
+std::string Controller::cachePrefix(const std::string& filename) {
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(filename, error);
+    QByteArray path = QByteArray::fromStdString(error ? filename : absolute.string());
+    QByteArray hash = QCryptographicHash::hash(path, QCryptographicHash::Sha1).toHex().left(16);
+    return hash.toStdString() + "-";
+}
+
+void Controller::setSplitOptions(const DatasetManager::SplitOptions& options) {
+    splitOptions_ = options;
+    if (!isTraining()) {
+        splitDataset();
+    }
+}
+
+void Controller::splitDataset() {
+    // Ensembles exprimés par indices : les données ne sont jamais copiées
+    DatasetSplit split = datasetManager_.split(splitOptions_);
+    trainSet_ = std::move(split.train);
+    validationSet_ = std::move(split.validation);
+    testSet_ = std::move(split.test);
+    ++datasetVersion_;
+}
+
+void Controller::invalidateEvaluationCache() {
+    testResultsValid_ = false;
+    cachedTestResults_ = TestResults();
+}
+
+bool Controller::startTraining(const Trainer::TrainingParams& params) {
+    if (!network_ || trainSet_.empty() || isTraining()) {
+        return false;
     }
     
     initializeTrainer();
     
     trainingErrors_.clear();
+    trainingDone_ = false;
+    trainingError_ = nullptr;
+    threadPool_->resetStats();
     
-    // Créer un thread pour l'entraînement (pour ne pas bloquer l'UI)
-    // Note: Pour une vraie implémentation thread-safe, utiliser QThread
-    // Pour simplifier ici, on fait l'entraînement de manière synchrone
-    // mais on émet des signaux pour la progression
-    
+    // Exécuté sur le thread d'entraînement : ne touche à aucun objet Qt
     Trainer::ProgressCallback callback = [this](size_t epoch, double error) {
-        trainingErrors_.push_back(error);
-        emit trainingProgress(epoch, error);
+        // File pleine (GUI en retard) : l'époque manquera seulement à
+        // l'affichage, l'historique complet est repris des résultats à la fin
+        progressQueue_.tryPush(ProgressEvent{epoch, error});
     };
     
-    trainer_->train(trainSamples_, params, callback);
+    trainingThread_ = std::thread([this, params, callback]() {
+        try {
+            trainingResults_ = trainer_->train(trainSet_, params, callback);
+        } catch (...) {
+            trainingError_ = std::current_exception();
+        }
+        trainingDone_.store(true, std::memory_order_release);
+    });
     
-    emit trainingFinished();
+    progressTimer_->start();
+    return true;
 }
 
 void Controller::stopTraining() {
@@ -93,13 +249,71 @@ void Controller::stopTraining() {
     }
 }
 
-double Controller::testNetwork() {
-    if (!network_ || testSamples_.empty()) {
-        return 0.0;
+void Controller::pauseTraining() {
+    if (trainer_ && isTraining()) {
+        trainer_->pause();
+    }
+}
+
+void Controller::resumeTraining() {
+    if (trainer_) {
+        trainer_->resume();
     }
+}
+
+void Controller::drainTrainingProgress() {
+    // Lire l'indicateur avant de vider : tout ce qui a été publié avant la
+    // fin du thread est alors visible dans la file
+    bool done = trainingDone_.load(std::memory_order_acquire);
     
-    initializeTrainer();
-    return trainer_->test(testSamples_);
+    // Un paquet par suite d'époques consécutives (une seule, sauf événements perdus)
+    size_t firstEpoch = 0;
+    progressBatch_.clear();
+    ProgressEvent event;
+    while (progressQueue_.tryPop(event)) {
+        trainingErrors_.push_back(event.error);
+        if (!progressBatch_.empty() && event.epoch != firstEpoch + progressBatch_.size()) {
+            emit trainingProgress(firstEpoch, progressBatch_);
+            progressBatch_.clear();
+        }
+        if (progressBatch_.empty()) {
+            firstEpoch = event.epoch;
+        }
+        progressBatch_.push_back(event.error);
+    }
+    if (!progressBatch_.empty()) {
+        emit trainingProgress(firstEpoch, progressBatch_);
+    }
+    
+    if (done) {
+        finishTraining();
+    }
+}
+
+void Controller::finishTraining() {
+    progressTimer_->stop();
+    trainingThread_.join();
+    
+    if (trainingError_) {
+        try {
+            std::rethrow_exception(trainingError_);
+        } catch (const std::exception& e) {
+            emit trainingFailed(QString::fromStdString(e.what()));
+        } catch (...) {
+            emit trainingFailed(QString("Erreur inconnue pendant l'entraînement"));
+        }
+        trainingError_ = nullptr;
+        return;
+    }
+    
+    // Historique complet, y compris les époques abandonnées par la file
+    trainingErrors_ = trainingResults_.epochErrors;
+    emit trainingFinished();
+}
+
+double Controller::testNetwork() {
+    // Même erreur que Trainer::test, sans refaire l'évaluation si elle est connue
+    return getDetailedTestResults().mse;
 }
 
 bool Controller::exportResults(const std::string& filename) {
@@ -113,154 +327,92 @@ DatasetManager::Statistics Controller::getDatasetStatistics() const {
     return datasetManager_.getStatistics();
 }
 
-Controller::TestResults Controller::getDetailedTestResults() {
-    TestResults results;
+const Controller::TestResults& Controller::getDetailedTestResults() {
+    static const TestResults emptyResults;
     
-    if (!network_ || testSamples_.empty()) {
-        return results;
+    if (!network_ || testSet_.empty() || isTraining()) {
+        return emptyResults;
     }
     
-    // Déterminer si c'est un problème de classification ou de régression
-    // On considère que c'est une classification si les sorties sont binaires (0 ou 1)
-    bool isBinary = true;
-    for (const auto& sample : testSamples_) {
-        for (double output : sample.outputs) {
-            if (output != 0.0 && output != 1.0) {
-                isBinary = false;
-                break;
-            }
-        }
-        if (!isBinary) break;
-    }
-    results.isClassification = isBinary && testSamples_[0].outputs.size() == 1;
-    
-    // Faire les prédictions
-    results.predictions.reserve(testSamples_.size());
-    results.actuals.reserve(testSamples_.size());
-    
-    double sumSquaredError = 0.0;
-    double sumAbsoluteError = 0.0;
-    
-    for (const auto& sample : testSamples_) {
-        std::vector<double> prediction = network_->forward(sample.inputs);
-        
-        for (size_t i = 0; i < prediction.size(); ++i) {
-            results.predictions.push_back(prediction[i]);
-            results.actuals.push_back(sample.outputs[i]);
-            
-            double error = prediction[i] - sample.outputs[i];
-            sumSquaredError += error * error;
-            sumAbsoluteError += std::abs(error);
-        }
+    if (!testResultsValid_ ||
+        testResultsNetworkVersion_ != network_->getVersion() ||
+        testResultsDatasetVersion_ != datasetVersion_) {
+        cachedTestResults_ = evaluator_.evaluate(*network_, testSet_);
+        testResultsValid_ = true;
+        testResultsNetworkVersion_ = network_->getVersion();
+        testResultsDatasetVersion_ = datasetVersion_;
     }
-    
-    size_t numValues = results.predictions.size();
-    if (numValues > 0) {
-        results.mse = sumSquaredError / numValues;
-        results.mae = sumAbsoluteError / numValues;
-        
-        // Calculer R²
-        double meanActual = std::accumulate(results.actuals.begin(), results.actuals.end(), 0.0) / numValues;
-        double totalSumSquares = 0.0;
-        for (double actual : results.actuals) {
-            double diff = actual - meanActual;
-            totalSumSquares += diff * diff;
-        }
-        if (totalSumSquares > 0.0) {
-            results.r2 = 1.0 - (sumSquaredError / totalSumSquares);
-        }
-        
-        // Calculer les métriques de classification
-        if (results.isClassification) {
-            // Créer la matrice de confusion
-            size_t numClasses = 2; // Binaire pour l'instant
-            results.confusionMatrix.resize(numClasses, std::vector<int>(numClasses, 0));
-            
-            int correct = 0;
-            for (size_t i = 0; i < numValues; ++i) {
-                int predicted = (results.predictions[i] >= 0.5) ? 1 : 0;
-                int actual = (results.actuals[i] >= 0.5) ? 1 : 0;
-                results.confusionMatrix[predicted][actual]++;
-                if (predicted == actual) correct++;
-            }
-            
-            results.accuracy = static_cast<double>(correct) / numValues;
-            
-            // Calculer précision, rappel, F1
-            int tp = results.confusionMatrix[1][1]; // True Positive
-            int fp = results.confusionMatrix[1][0]; // False Positive
-            int fn = results.confusionMatrix[0][1]; // False Negative
-            
-            if (tp + fp > 0) {
-                results.precision = static_cast<double>(tp) / (tp + fp);
-            }
-            if (tp + fn > 0) {
-                results.recall = static_cast<double>(tp) / (tp + fn);
-            }
-            if (results.precision + results.recall > 0) {
-                results.f1Score = 2.0 * (results.precision * results.recall) / 
-                                 (results.precision + results.recall);
-            }
-        }
+    return cachedTestResults_;
+}
+
+const std::vector<std::vector<double>>& Controller::getCorrelationMatrix() const {
+    if (!correlationValid_ || correlationDatasetVersion_ != datasetVersion_) {
+        cachedCorrelationMatrix_ = computeCorrelationMatrix();
+        correlationValid_ = true;
+        correlationDatasetVersion_ = datasetVersion_;
     }
-    
-    return results;
+    return cachedCorrelationMatrix_;
 }
 
-std::vector<std::vector<double>> Controller::getCorrelationMatrix() const {
+std::vector<std::vector<double>> Controller::computeCorrelationMatrix() const {
     std::vector<std::vector<double>> correlationMatrix;
     
-    if (testSamples_.empty()) {
+    if (testSet_.empty()) {
         return correlationMatrix;
     }
     
-    size_t numInputs = testSamples_[0].inputs.size();
-    size_t numOutputs = testSamples_[0].outputs.size();
+    size_t numInputs = testSet_.getNumInputs();
+    size_t numOutputs = testSet_.getNumOutputs();
     size_t numVars = numInputs + numOutputs;
+    size_t numSamples = testSet_.size();
+    
+    // Rassembler les échantillons de test dans deux matrices contiguës
+    Matrix inputs;
+    Matrix outputs;
+    datasetManager_.packInputs(testSet_.getIndices(), inputs);
+    datasetManager_.packOutputs(testSet_.getIndices(), outputs);
+    
+    auto value = [&](size_t row, size_t var) {
+        return var < numInputs ? inputs(row, var) : outputs(row, var - numInputs);
+    };
     
-    // Créer une matrice de données combinée
-    std::vector<std::vector<double>> data(numVars);
-    for (size_t i = 0; i < numInputs; ++i) {
-        data[i].reserve(testSamples_.size());
-        for (const auto& sample : testSamples_) {
-            data[i].push_back(sample.inputs[i]);
+    // Moyennes par variable
+    std::vector<double> means(numVars, 0.0);
+    for (size_t k = 0; k < numSamples; ++k) {
+        for (size_t v = 0; v < numVars; ++v) {
+            means[v] += value(k, v);
         }
     }
-    for (size_t i = 0; i < numOutputs; ++i) {
-        data[numInputs + i].reserve(testSamples_.size());
-        for (const auto& sample : testSamples_) {
-            data[numInputs + i].push_back(sample.outputs[i]);
+    for (double& mean : means) {
+        mean /= static_cast<double>(numSamples);
+    }
+    
+    // Sommes des produits centrés en une seule passe sur les lignes
+    // (triangle supérieur uniquement, la matrice est symétrique)
+    std::vector<double> centered(numVars);
+    std::vector<double> crossSums(numVars * numVars, 0.0);
+    for (size_t k = 0; k < numSamples; ++k) {
+        for (size_t v = 0; v < numVars; ++v) {
+            centered[v] = value(k, v) - means[v];
+        }
+        for (size_t i = 0; i < numVars; ++i) {
+            double* sums = crossSums.data() + i * numVars;
+            for (size_t j = i; j < numVars; ++j) {
+                sums[j] += centered[i] * centered[j];
+            }
         }
     }
     
-    // Calculer la matrice de corrélation
+    // Calculer la matrice de corrélation de Pearson
     correlationMatrix.resize(numVars, std::vector<double>(numVars, 0.0));
     
     for (size_t i = 0; i < numVars; ++i) {
-        for (size_t j = 0; j < numVars; ++j) {
-            if (i == j) {
-                correlationMatrix[i][j] = 1.0;
-            } else {
-                // Calculer la corrélation de Pearson
-                double meanI = std::accumulate(data[i].begin(), data[i].end(), 0.0) / data[i].size();
-                double meanJ = std::accumulate(data[j].begin(), data[j].end(), 0.0) / data[j].size();
-                
-                double numerator = 0.0;
-                double sumSqI = 0.0;
-                double sumSqJ = 0.0;
-                
-                for (size_t k = 0; k < data[i].size(); ++k) {
-                    double diffI = data[i][k] - meanI;
-                    double diffJ = data[j][k] - meanJ;
-                    numerator += diffI * diffJ;
-                    sumSqI += diffI * diffI;
-                    sumSqJ += diffJ * diffJ;
-                }
-                
-                double denominator = std::sqrt(sumSqI * sumSqJ);
-                if (denominator > 0.0) {
-                    correlationMatrix[i][j] = numerator / denominator;
-                }
+        correlationMatrix[i][i] = 1.0;
+        for (size_t j = i + 1; j < numVars; ++j) {
+            double denominator = std::sqrt(crossSums[i * numVars + i] * crossSums[j * numVars + j]);
+            if (denominator > 0.0) {
+                correlationMatrix[i][j] = crossSums[i * numVars + j] / denominator;
+                correlationMatrix[j][i] = correlationMatrix[i][j];
             }
         }
     }
@@ -275,6 +427,30 @@ void Controller::initializeTrainer() {
         // Recréer le trainer si le réseau a changé
         trainer_ = std::make_shared<Trainer>(network_);
     }
+    if (trainer_) {
+        trainer_->setThreadPool(threadPool_.get());
+    }
+}
+
+bool Controller::configureThreadPool(const ThreadPool::Options& options) {
+    if (isTraining()) {
+        return false;
+    }
+    
+    // Détacher l'ancien pool avant sa destruction
+    datasetManager_.setThreadPool(nullptr);
+    evaluator_.setThreadPool(nullptr);
+    if (trainer_) {
+        trainer_->setThreadPool(nullptr);
+    }
+    threadPool_ = std::make_unique<ThreadPool>(options);
+    
+    datasetManager_.setThreadPool(threadPool_.get());
+    evaluator_.setThreadPool(threadPool_.get());
+    if (trainer_) {
+        trainer_->setThreadPool(threadPool_.get());
+    }
+    return true;
 }
 
 } // namespace NeuroUIT
@@ -0,0 +1,127 @@
+#include "core/ActivationKernels.h"
+#include "core/Kernels.h"
+#include <cmath>
+
+namespace NeuroUIT {
+
+namespace {
+
+struct SigmoidOp {
+    template <typename T>
+    static T apply(T x) {
+        // exp(-x) vaut +inf pour x très négatif : le résultat tend proprement vers 0
+        return T(1) / (T(1) + std::exp(-x));
+    }
+    template <typename T>
+    static T derivative(T y) { return y * (T(1) - y); }
+};
+
+struct TanhOp {
+    template <typename T>
+    static T apply(T x) { return std::tanh(x); }
+    template <typename T>
+    static T derivative(T y) { return T(1) - y * y; }
+};
+
+struct ReLUOp {
+    template <typename T>
+    static T apply(T x) { return x > T(0) ? x : T(0); }
+    template <typename T>
+    static T derivative(T y) { return y > T(0) ? T(1) : T(0); }
+};
+
+struct LinearOp {
+    template <typename T>
+    static T apply(T x) { return x; }
+    template <typename T>
+    static T derivative(T) { return T(1); }
+};
+
+template <typename Op, typename T>
+void activateLoop(const T* in, const T* bias, T* out, size_t n, T* netInputs) {
+    if (bias && netInputs) {
+        for (size_t i = 0; i < n; ++i) {
+            T x = in[i] + bias[i];
+            netInputs[i] = x;
+            out[i] = Op::apply(x);
+        }
+    } else if (bias) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = Op::apply(in[i] + bias[i]);
+        }
+    } else if (netInputs) {
+        for (size_t i = 0; i < n; ++i) {
+            netInputs[i] = in[i];
+            out[i] = Op::apply(in[i]);
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = Op::apply(in[i]);
+        }
+    }
+}
+
+template <typename Op, typename T>
+void derivativeLoop(const T* outputs, T* deltas, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        deltas[i] *= Op::derivative(outputs[i]);
+    }
+}
+
+} // namespace
+
+template <typename T>
+void ActivationKernels::activate(ActivationType type, const T* in, const T* bias, T* out, size_t n,
+                                 T* netInputs, ActivationAccuracy accuracy) {
+    bool approximate = accuracy == ActivationAccuracy::Approximate;
+    switch (type) {
+        case ActivationType::Sigmoid:
+            if (approximate) {
+                activateLoop<LinearOp>(in, bias, out, n, netInputs);
+                Kernels::fastSigmoid(out, out, n);
+            } else {
+                activateLoop<SigmoidOp>(in, bias, out, n, netInputs);
+            }
+            break;
+        case ActivationType::Tanh:
+            if (approximate) {
+                activateLoop<LinearOp>(in, bias, out, n, netInputs);
+                Kernels::fastTanh(out, out, n);
+            } else {
+                activateLoop<TanhOp>(in, bias, out, n, netInputs);
+            }
+            break;
+        case ActivationType::ReLU:
+            activateLoop<ReLUOp>(in, bias, out, n, netInputs);
+            break;
+        case ActivationType::Linear:
+            activateLoop<LinearOp>(in, bias, out, n, netInputs);
+            break;
+    }
+}
+
+template <typename T>
+void ActivationKernels::multiplyDerivative(ActivationType type, const T* outputs, T* deltas, size_t n) {
+    switch (type) {
+        case ActivationType::Sigmoid:
+            derivativeLoop<SigmoidOp>(outputs, deltas, n);
+            break;
+        case ActivationType::Tanh:
+            derivativeLoop<TanhOp>(outputs, deltas, n);
+            break;
+        case ActivationType::ReLU:
+            derivativeLoop<ReLUOp>(outputs, deltas, n);
+            break;
+        case ActivationType::Linear:
+            break;
+    }
+}
+
+template void ActivationKernels::activate<float>(ActivationType, const float*, const float*, float*, size_t,
+                                                 float*, ActivationAccuracy);
+template void ActivationKernels::activate<double>(ActivationType, const double*, const double*, double*, size_t,
+                                                  double*, ActivationAccuracy);
+template void ActivationKernels::multiplyDerivative<float>(ActivationType, const float*, float*, size_t);
+template void ActivationKernels::multiplyDerivative<double>(ActivationType, const double*, double*, size_t);
+
+} // namespace NeuroUIT
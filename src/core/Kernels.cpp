@@ -0,0 +1,825 @@
+#include "core/Kernels.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define NEUROUIT_X86_DISPATCH 1
+#include <immintrin.h>
+#define NEUROUIT_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace NeuroUIT {
+
+namespace {
+
+/**
+ * @brief Table des implémentations pour un niveau SIMD
+ */
+struct KernelTable {
+    SimdLevel level;
+    double (*dot)(const double*, const double*, size_t);
+    void (*axpy)(size_t, double, const double*, double*);
+    void (*momentumUpdate)(size_t, double, double, double*, double*, double*);
+    float (*dotF)(const float*, const float*, size_t);
+    void (*axpyF)(size_t, float, const float*, float*);
+    void (*momentumUpdateF)(size_t, float, float, float*, float*, float*);
+    void (*fastSigmoid)(const double*, double*, size_t);
+    void (*fastTanh)(const double*, double*, size_t);
+    void (*fastSigmoidF)(const float*, float*, size_t);
+    void (*fastTanhF)(const float*, float*, size_t);
+};
+
+// ---------------------------------------------------------------------------
+// Approximation de exp : x = n·ln2 + r, |r| <= ln2/2, exp(r) par Taylor de
+// degré 7 (reste < 6e-9), puis multiplication par 2^n
+// ---------------------------------------------------------------------------
+
+constexpr double kLog2e = 1.4426950408889634;
+// Au-delà, sigmoid et tanh sont saturées et 2^n reste représentable en float
+constexpr double kFastExpMaxArg = 80.0;
+constexpr double kExpCoeffs[8] = {
+    1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040
+};
+
+template <typename T>
+struct FloatTraits;
+
+template <>
+struct FloatTraits<double> {
+    using Bits = int64_t;
+    static constexpr int kMantissaBits = 52;
+    static constexpr Bits kExponentBias = 1023;
+    // ln2 découpé en deux pour que n·ln2Hi soit exact
+    static constexpr double kLn2Hi = 6.93147180369123816490e-01;
+    static constexpr double kLn2Lo = 1.90821492927058770002e-10;
+};
+
+template <>
+struct FloatTraits<float> {
+    using Bits = int32_t;
+    static constexpr int kMantissaBits = 23;
+    static constexpr Bits kExponentBias = 127;
+    static constexpr float kLn2Hi = 0.693359375f;
+    static constexpr float kLn2Lo = -2.12194440e-4f;
+};
+
+template <typename T>
+T fastExpScalar(T x) {
+    using Traits = FloatTraits<T>;
+    using Bits = typename Traits::Bits;
+    const T maxArg = static_cast<T>(kFastExpMaxArg);
+    x = std::min(std::max(x, -maxArg), maxArg);
+
+    // Arrondi à l'entier le plus proche par ajout/retrait de 1.5 · 2^mantisse
+    const T roundMagic = static_cast<T>(1.5) * static_cast<T>(Bits(1) << Traits::kMantissaBits);
+    T n = (x * static_cast<T>(kLog2e) + roundMagic) - roundMagic;
+    T r = x - n * Traits::kLn2Hi - n * Traits::kLn2Lo;
+
+    T p = static_cast<T>(kExpCoeffs[7]);
+    for (int k = 6; k >= 0; --k) {
+        p = p * r + static_cast<T>(kExpCoeffs[k]);
+    }
+
+    // 2^n construit directement dans l'exposant
+    Bits bits = (static_cast<Bits>(n) + Traits::kExponentBias) << Traits::kMantissaBits;
+    T scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+template <typename T>
+void fastSigmoidScalar(const T* x, T* y, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = T(1) / (T(1) + fastExpScalar(-x[i]));
+    }
+}
+
+template <typename T>
+void fastTanhScalar(const T* x, T* y, size_t n) {
+    // tanh(x) = 1 - 2 / (1 + exp(2x)) : erreur absolue (et non relative) près de 0
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = T(1) - T(2) / (T(1) + fastExpScalar(T(2) * x[i]));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Implémentations scalaires (référence et repli)
+// ---------------------------------------------------------------------------
+
+template <typename T>
+T dotScalar(const T* x, const T* y, size_t n) {
+    T sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+template <typename T>
+void axpyScalar(size_t n, T alpha, const T* x, T* y) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+template <typename T>
+void momentumUpdateScalar(size_t n, T step, T momentum,
+                          T* weights, T* velocity, T* gradient) {
+    for (size_t i = 0; i < n; ++i) {
+        velocity[i] = momentum * velocity[i] - step * gradient[i];
+        weights[i] += velocity[i];
+        gradient[i] = 0;
+    }
+}
+
+#ifdef NEUROUIT_X86_DISPATCH
+
+// ---------------------------------------------------------------------------
+// SSE2 : 2 doubles ou 4 floats par registre
+// ---------------------------------------------------------------------------
+
+NEUROUIT_TARGET("sse2")
+double dotSSE2(const double* x, const double* y, size_t n) {
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(y + i)));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(x + i + 2), _mm_loadu_pd(y + i + 2)));
+    }
+    acc0 = _mm_add_pd(acc0, acc1);
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc0);
+    double sum = lanes[0] + lanes[1];
+    for (; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+NEUROUIT_TARGET("sse2")
+void axpySSE2(size_t n, double alpha, const double* x, double* y) {
+    __m128d a = _mm_set1_pd(alpha);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(a, _mm_loadu_pd(x + i))));
+    }
+    for (; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+NEUROUIT_TARGET("sse2")
+void momentumUpdateSSE2(size_t n, double step, double momentum,
+                        double* weights, double* velocity, double* gradient) {
+    __m128d s = _mm_set1_pd(step);
+    __m128d m = _mm_set1_pd(momentum);
+    __m128d zero = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d v = _mm_sub_pd(_mm_mul_pd(m, _mm_loadu_pd(velocity + i)),
+                               _mm_mul_pd(s, _mm_loadu_pd(gradient + i)));
+        _mm_storeu_pd(velocity + i, v);
+        _mm_storeu_pd(weights + i, _mm_add_pd(_mm_loadu_pd(weights + i), v));
+        _mm_storeu_pd(gradient + i, zero);
+    }
+    momentumUpdateScalar(n - i, step, momentum, weights + i, velocity + i, gradient + i);
+}
+
+NEUROUIT_TARGET("sse2")
+float dotSSE2(const float* x, const float* y, size_t n) {
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(x + i + 4), _mm_loadu_ps(y + i + 4)));
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, _mm_add_ps(acc0, acc1));
+    float sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+NEUROUIT_TARGET("sse2")
+void axpySSE2(size_t n, float alpha, const float* x, float* y) {
+    __m128 a = _mm_set1_ps(alpha);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(a, _mm_loadu_ps(x + i))));
+    }
+    for (; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+NEUROUIT_TARGET("sse2")
+void momentumUpdateSSE2(size_t n, float step, float momentum,
+                        float* weights, float* velocity, float* gradient) {
+    __m128 s = _mm_set1_ps(step);
+    __m128 m = _mm_set1_ps(momentum);
+    __m128 zero = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 v = _mm_sub_ps(_mm_mul_ps(m, _mm_loadu_ps(velocity + i)),
+                              _mm_mul_ps(s, _mm_loadu_ps(gradient + i)));
+        _mm_storeu_ps(velocity + i, v);
+        _mm_storeu_ps(weights + i, _mm_add_ps(_mm_loadu_ps(weights + i), v));
+        _mm_storeu_ps(gradient + i, zero);
+    }
+    momentumUpdateScalar(n - i, step, momentum, weights + i, velocity + i, gradient + i);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2 + FMA : 4 doubles ou 8 floats par registre
+// ---------------------------------------------------------------------------
+
+NEUROUIT_TARGET("avx2,fma")
+double dotAVX2(const double* x, const double* y, size_t n) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), acc0);
+        acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4), acc1);
+    }
+    for (; i + 4 <= n; i += 4) {
+        acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), acc0);
+    }
+    acc0 = _mm256_add_pd(acc0, acc1);
+    __m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+    double sum = _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+    for (; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+NEUROUIT_TARGET("avx2,fma")
+void axpyAVX2(size_t n, double alpha, const double* x, double* y) {
+    __m256d a = _mm256_set1_pd(alpha);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+    }
+    for (; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+NEUROUIT_TARGET("avx2,fma")
+void momentumUpdateAVX2(size_t n, double step, double momentum,
+                        double* weights, double* velocity, double* gradient) {
+    __m256d s = _mm256_set1_pd(step);
+    __m256d m = _mm256_set1_pd(momentum);
+    __m256d zero = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v = _mm256_fnmadd_pd(s, _mm256_loadu_pd(gradient + i),
+                                     _mm256_mul_pd(m, _mm256_loadu_pd(velocity + i)));
+        _mm256_storeu_pd(velocity + i, v);
+        _mm256_storeu_pd(weights + i, _mm256_add_pd(_mm256_loadu_pd(weights + i), v));
+        _mm256_storeu_pd(gradient + i, zero);
+    }
+    momentumUpdateScalar(n - i, step, momentum, weights + i, velocity + i, gradient + i);
+}
+
+NEUROUIT_TARGET("avx2,fma")
+float dotAVX2(const float* x, const float* y, size_t n) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 8), _mm256_loadu_ps(y + i + 8), acc1);
+    }
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), acc0);
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+    half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    float sum = _mm_cvtss_f32(_mm_add_ss(half, _mm_shuffle_ps(half, half, 1)));
+    for (; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+NEUROUIT_TARGET("avx2,fma")
+void axpyAVX2(size_t n, float alpha, const float* x, float* y) {
+    __m256 a = _mm256_set1_ps(alpha);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(a, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+    for (; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+NEUROUIT_TARGET("avx2,fma")
+void momentumUpdateAVX2(size_t n, float step, float momentum,
+                        float* weights, float* velocity, float* gradient) {
+    __m256 s = _mm256_set1_ps(step);
+    __m256 m = _mm256_set1_ps(momentum);
+    __m256 zero = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_fnmadd_ps(s, _mm256_loadu_ps(gradient + i),
+                                    _mm256_mul_ps(m, _mm256_loadu_ps(velocity + i)));
+        _mm256_storeu_ps(velocity + i, v);
+        _mm256_storeu_ps(weights + i, _mm256_add_ps(_mm256_loadu_ps(weights + i), v));
+        _mm256_storeu_ps(gradient + i, zero);
+    }
+    momentumUpdateScalar(n - i, step, momentum, weights + i, velocity + i, gradient + i);
+}
+
+NEUROUIT_TARGET("avx2,fma")
+inline __m256d expAVX2(__m256d x) {
+    const __m256d maxArg = _mm256_set1_pd(kFastExpMaxArg);
+    x = _mm256_min_pd(_mm256_max_pd(x, _mm256_sub_pd(_mm256_setzero_pd(), maxArg)), maxArg);
+    __m256d n = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(kLog2e)),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(n, _mm256_set1_pd(FloatTraits<double>::kLn2Hi), x);
+    r = _mm256_fnmadd_pd(n, _mm256_set1_pd(FloatTraits<double>::kLn2Lo), r);
+    __m256d p = _mm256_set1_pd(kExpCoeffs[7]);
+    for (int k = 6; k >= 0; --k) {
+        p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(kExpCoeffs[k]));
+    }
+    __m256i e = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n));
+    e = _mm256_slli_epi64(_mm256_add_epi64(e, _mm256_set1_epi64x(1023)), 52);
+    return _mm256_mul_pd(p, _mm256_castsi256_pd(e));
+}
+
+NEUROUIT_TARGET("avx2,fma")
+inline __m256 expAVX2(__m256 x) {
+    const __m256 maxArg = _mm256_set1_ps(static_cast<float>(kFastExpMaxArg));
+    x = _mm256_min_ps(_mm256_max_ps(x, _mm256_sub_ps(_mm256_setzero_ps(), maxArg)), maxArg);
+    __m256 n = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(static_cast<float>(kLog2e))),
+                               _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(FloatTraits<float>::kLn2Hi), x);
+    r = _mm256_fnmadd_ps(n, _mm256_set1_ps(FloatTraits<float>::kLn2Lo), r);
+    __m256 p = _mm256_set1_ps(static_cast<float>(kExpCoeffs[7]));
+    for (int k = 6; k >= 0; --k) {
+        p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(static_cast<float>(kExpCoeffs[k])));
+    }
+    __m256i e = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(p, _mm256_castsi256_ps(e));
+}
+
+NEUROUIT_TARGET("avx2,fma")
+void fastSigmoidAVX2(const double* x, double* y, size_t n) {
+    const __m256d one = _mm256_set1_pd(1.0);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d e = expAVX2(_mm256_sub_pd(_mm256_setzero_pd(), _mm256_loadu_pd(x + i)));
+        _mm256_storeu_pd(y + i, _mm256_div_pd(one, _mm256_add_pd(one, e)));
+    }
+    // La queue appelle du code non-AVX : éviter la pénalité de transition SSE/AVX
+    _mm256_zeroupper();
+    fastSigmoidScalar(x + i, y + i, n - i);
+}
+
+NEUROUIT_TARGET("avx2,fma")
+void fastTanhAVX2(const double* x, double* y, size_t n) {
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d two = _mm256_set1_pd(2.0);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d e = expAVX2(_mm256_mul_pd(two, _mm256_loadu_pd(x + i)));
+        _mm256_storeu_pd(y + i, _mm256_sub_pd(one, _mm256_div_pd(two, _mm256_add_pd(one, e))));
+    }
+    // La queue appelle du code non-AVX : éviter la pénalité de transition SSE/AVX
+    _mm256_zeroupper();
+    fastTanhScalar(x + i, y + i, n - i);
+}
+
+NEUROUIT_TARGET("avx2,fma")
+void fastSigmoidAVX2(const float* x, float* y, size_t n) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 e = expAVX2(_mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(x + i)));
+        _mm256_storeu_ps(y + i, _mm256_div_ps(one, _mm256_add_ps(one, e)));
+    }
+    // La queue appelle du code non-AVX : éviter la pénalité de transition SSE/AVX
+    _mm256_zeroupper();
+    fastSigmoidScalar(x + i, y + i, n - i);
+}
+
+NEUROUIT_TARGET("avx2,fma")
+void fastTanhAVX2(const float* x, float* y, size_t n) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 e = expAVX2(_mm256_mul_ps(two, _mm256_loadu_ps(x + i)));
+        _mm256_storeu_ps(y + i, _mm256_sub_ps(one, _mm256_div_ps(two, _mm256_add_ps(one, e))));
+    }
+    // La queue appelle du code non-AVX : éviter la pénalité de transition SSE/AVX
+    _mm256_zeroupper();
+    fastTanhScalar(x + i, y + i, n - i);
+}
+
+// ---------------------------------------------------------------------------
+// AVX-512F : 8 doubles ou 16 floats par registre, queue traitée par masque
+//
+// Les formes masquées (masque plein, source explicite) remplacent celles qui
+// passent par _mm512_undefined_*, que GCC signale à tort en -Wuninitialized.
+// ---------------------------------------------------------------------------
+
+constexpr __mmask8 kAllLanesPd = 0xFF;
+constexpr __mmask16 kAllLanesPs = 0xFFFF;
+
+NEUROUIT_TARGET("avx512f")
+inline double horizontalSumAVX512(__m512d v) {
+    alignas(64) double lanes[8];
+    _mm512_store_pd(lanes, v);
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+           ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+NEUROUIT_TARGET("avx512f")
+inline float horizontalSumAVX512(__m512 v) {
+    alignas(64) float lanes[16];
+    _mm512_store_ps(lanes, v);
+    float sum = 0.0f;
+    for (int k = 0; k < 16; ++k) {
+        sum += lanes[k];
+    }
+    return sum;
+}
+
+NEUROUIT_TARGET("avx512f")
+double dotAVX512(const double* x, const double* y, size_t n) {
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), acc0);
+        acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(y + i + 8), acc1);
+    }
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), acc0);
+    }
+    if (i < n) {
+        __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1u);
+        acc1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, x + i),
+                               _mm512_maskz_loadu_pd(mask, y + i), acc1);
+    }
+    return horizontalSumAVX512(_mm512_add_pd(acc0, acc1));
+}
+
+NEUROUIT_TARGET("avx512f")
+void axpyAVX512(size_t n, double alpha, const double* x, double* y) {
+    __m512d a = _mm512_set1_pd(alpha);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(a, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+    }
+    if (i < n) {
+        __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1u);
+        __m512d result = _mm512_fmadd_pd(a, _mm512_maskz_loadu_pd(mask, x + i),
+                                         _mm512_maskz_loadu_pd(mask, y + i));
+        _mm512_mask_storeu_pd(y + i, mask, result);
+    }
+}
+
+NEUROUIT_TARGET("avx512f")
+void momentumUpdateAVX512(size_t n, double step, double momentum,
+                          double* weights, double* velocity, double* gradient) {
+    __m512d s = _mm512_set1_pd(step);
+    __m512d m = _mm512_set1_pd(momentum);
+    __m512d zero = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d v = _mm512_fnmadd_pd(s, _mm512_loadu_pd(gradient + i),
+                                     _mm512_mul_pd(m, _mm512_loadu_pd(velocity + i)));
+        _mm512_storeu_pd(velocity + i, v);
+        _mm512_storeu_pd(weights + i, _mm512_add_pd(_mm512_loadu_pd(weights + i), v));
+        _mm512_storeu_pd(gradient + i, zero);
+    }
+    momentumUpdateScalar(n - i, step, momentum, weights + i, velocity + i, gradient + i);
+}
+
+NEUROUIT_TARGET("avx512f")
+float dotAVX512(const float* x, const float* y, size_t n) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i + 16), _mm512_loadu_ps(y + i + 16), acc1);
+    }
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i), acc0);
+    }
+    if (i < n) {
+        __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1u);
+        acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, x + i),
+                               _mm512_maskz_loadu_ps(mask, y + i), acc1);
+    }
+    return horizontalSumAVX512(_mm512_add_ps(acc0, acc1));
+}
+
+NEUROUIT_TARGET("avx512f")
+void axpyAVX512(size_t n, float alpha, const float* x, float* y) {
+    __m512 a = _mm512_set1_ps(alpha);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(a, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    if (i < n) {
+        __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1u);
+        __m512 result = _mm512_fmadd_ps(a, _mm512_maskz_loadu_ps(mask, x + i),
+                                        _mm512_maskz_loadu_ps(mask, y + i));
+        _mm512_mask_storeu_ps(y + i, mask, result);
+    }
+}
+
+NEUROUIT_TARGET("avx512f")
+void momentumUpdateAVX512(size_t n, float step, float momentum,
+                          float* weights, float* velocity, float* gradient) {
+    __m512 s = _mm512_set1_ps(step);
+    __m512 m = _mm512_set1_ps(momentum);
+    __m512 zero = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 v = _mm512_fnmadd_ps(s, _mm512_loadu_ps(gradient + i),
+                                    _mm512_mul_ps(m, _mm512_loadu_ps(velocity + i)));
+        _mm512_storeu_ps(velocity + i, v);
+        _mm512_storeu_ps(weights + i, _mm512_add_ps(_mm512_loadu_ps(weights + i), v));
+        _mm512_storeu_ps(gradient + i, zero);
+    }
+    momentumUpdateScalar(n - i, step, momentum, weights + i, velocity + i, gradient + i);
+}
+
+NEUROUIT_TARGET("avx512f")
+inline __m512d expAVX512(__m512d x) {
+    const __m512d maxArg = _mm512_set1_pd(kFastExpMaxArg);
+    x = _mm512_mask_max_pd(x, kAllLanesPd, x, _mm512_sub_pd(_mm512_setzero_pd(), maxArg));
+    x = _mm512_mask_min_pd(x, kAllLanesPd, x, maxArg);
+    __m512d scaled = _mm512_mul_pd(x, _mm512_set1_pd(kLog2e));
+    __m512d n = _mm512_mask_roundscale_pd(scaled, kAllLanesPd, scaled,
+                                          _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512d r = _mm512_fnmadd_pd(n, _mm512_set1_pd(FloatTraits<double>::kLn2Hi), x);
+    r = _mm512_fnmadd_pd(n, _mm512_set1_pd(FloatTraits<double>::kLn2Lo), r);
+    __m512d p = _mm512_set1_pd(kExpCoeffs[7]);
+    for (int k = 6; k >= 0; --k) {
+        p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(kExpCoeffs[k]));
+    }
+    // scalef : p · 2^n sans manipulation de l'exposant
+    return _mm512_mask_scalef_pd(p, kAllLanesPd, p, n);
+}
+
+NEUROUIT_TARGET("avx512f")
+inline __m512 expAVX512(__m512 x) {
+    const __m512 maxArg = _mm512_set1_ps(static_cast<float>(kFastExpMaxArg));
+    x = _mm512_mask_max_ps(x, kAllLanesPs, x, _mm512_sub_ps(_mm512_setzero_ps(), maxArg));
+    x = _mm512_mask_min_ps(x, kAllLanesPs, x, maxArg);
+    __m512 scaled = _mm512_mul_ps(x, _mm512_set1_ps(static_cast<float>(kLog2e)));
+    __m512 n = _mm512_mask_roundscale_ps(scaled, kAllLanesPs, scaled,
+                                         _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(FloatTraits<float>::kLn2Hi), x);
+    r = _mm512_fnmadd_ps(n, _mm512_set1_ps(FloatTraits<float>::kLn2Lo), r);
+    __m512 p = _mm512_set1_ps(static_cast<float>(kExpCoeffs[7]));
+    for (int k = 6; k >= 0; --k) {
+        p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(static_cast<float>(kExpCoeffs[k])));
+    }
+    return _mm512_mask_scalef_ps(p, kAllLanesPs, p, n);
+}
+
+NEUROUIT_TARGET("avx512f")
+void fastSigmoidAVX512(const double* x, double* y, size_t n) {
+    const __m512d one = _mm512_set1_pd(1.0);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d e = expAVX512(_mm512_sub_pd(_mm512_setzero_pd(), _mm512_loadu_pd(x + i)));
+        _mm512_storeu_pd(y + i, _mm512_div_pd(one, _mm512_add_pd(one, e)));
+    }
+    if (i < n) {
+        __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1u);
+        __m512d e = expAVX512(_mm512_sub_pd(_mm512_setzero_pd(), _mm512_maskz_loadu_pd(mask, x + i)));
+        _mm512_mask_storeu_pd(y + i, mask, _mm512_div_pd(one, _mm512_add_pd(one, e)));
+    }
+}
+
+NEUROUIT_TARGET("avx512f")
+void fastTanhAVX512(const double* x, double* y, size_t n) {
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d two = _mm512_set1_pd(2.0);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d e = expAVX512(_mm512_mul_pd(two, _mm512_loadu_pd(x + i)));
+        _mm512_storeu_pd(y + i, _mm512_sub_pd(one, _mm512_div_pd(two, _mm512_add_pd(one, e))));
+    }
+    if (i < n) {
+        __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1u);
+        __m512d e = expAVX512(_mm512_mul_pd(two, _mm512_maskz_loadu_pd(mask, x + i)));
+        _mm512_mask_storeu_pd(y + i, mask, _mm512_sub_pd(one, _mm512_div_pd(two, _mm512_add_pd(one, e))));
+    }
+}
+
+NEUROUIT_TARGET("avx512f")
+void fastSigmoidAVX512(const float* x, float* y, size_t n) {
+    const __m512 one = _mm512_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 e = expAVX512(_mm512_sub_ps(_mm512_setzero_ps(), _mm512_loadu_ps(x + i)));
+        _mm512_storeu_ps(y + i, _mm512_div_ps(one, _mm512_add_ps(one, e)));
+    }
+    if (i < n) {
+        __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1u);
+        __m512 e = expAVX512(_mm512_sub_ps(_mm512_setzero_ps(), _mm512_maskz_loadu_ps(mask, x + i)));
+        _mm512_mask_storeu_ps(y + i, mask, _mm512_div_ps(one, _mm512_add_ps(one, e)));
+    }
+}
+
+NEUROUIT_TARGET("avx512f")
+void fastTanhAVX512(const float* x, float* y, size_t n) {
+    const __m512 one = _mm512_set1_ps(1.0f);
+    const __m512 two = _mm512_set1_ps(2.0f);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 e = expAVX512(_mm512_mul_ps(two, _mm512_loadu_ps(x + i)));
+        _mm512_storeu_ps(y + i, _mm512_sub_ps(one, _mm512_div_ps(two, _mm512_add_ps(one, e))));
+    }
+    if (i < n) {
+        __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1u);
+        __m512 e = expAVX512(_mm512_mul_ps(two, _mm512_maskz_loadu_ps(mask, x + i)));
+        _mm512_mask_storeu_ps(y + i, mask, _mm512_sub_ps(one, _mm512_div_ps(two, _mm512_add_ps(one, e))));
+    }
+}
+
+#endif // NEUROUIT_X86_DISPATCH
+
+const KernelTable kScalarTable = {
+    SimdLevel::Scalar,
+    dotScalar<double>, axpyScalar<double>, momentumUpdateScalar<double>,
+    dotScalar<float>, axpyScalar<float>, momentumUpdateScalar<float>,
+    fastSigmoidScalar<double>, fastTanhScalar<double>,
+    fastSigmoidScalar<float>, fastTanhScalar<float>
+};
+#ifdef NEUROUIT_X86_DISPATCH
+const KernelTable kSSE2Table = {
+    SimdLevel::SSE2,
+    dotSSE2, axpySSE2, momentumUpdateSSE2,
+    dotSSE2, axpySSE2, momentumUpdateSSE2,
+    // Pas d'arrondi vectoriel en SSE2 : approximations scalaires
+    fastSigmoidScalar<double>, fastTanhScalar<double>,
+    fastSigmoidScalar<float>, fastTanhScalar<float>
+};
+const KernelTable kAVX2Table = {
+    SimdLevel::AVX2,
+    dotAVX2, axpyAVX2, momentumUpdateAVX2,
+    dotAVX2, axpyAVX2, momentumUpdateAVX2,
+    fastSigmoidAVX2, fastTanhAVX2,
+    fastSigmoidAVX2, fastTanhAVX2
+};
+const KernelTable kAVX512Table = {
+    SimdLevel::AVX512,
+    dotAVX512, axpyAVX512, momentumUpdateAVX512,
+    dotAVX512, axpyAVX512, momentumUpdateAVX512,
+    fastSigmoidAVX512, fastTanhAVX512,
+    fastSigmoidAVX512, fastTanhAVX512
+};
+#endif
+
+const KernelTable* tableFor(SimdLevel level) {
+    switch (level) {
+#ifdef NEUROUIT_X86_DISPATCH
+        case SimdLevel::AVX512:
+            return &kAVX512Table;
+        case SimdLevel::AVX2:
+            return &kAVX2Table;
+        case SimdLevel::SSE2:
+            return &kSSE2Table;
+#endif
+        default:
+            return &kScalarTable;
+    }
+}
+
+/**
+ * @brief Niveau demandé via NEUROUIT_SIMD (ou le niveau détecté à défaut)
+ */
+SimdLevel requestedLevel() {
+    const char* env = std::getenv("NEUROUIT_SIMD");
+    if (env) {
+        if (std::strcmp(env, "scalar") == 0) return SimdLevel::Scalar;
+        if (std::strcmp(env, "sse2") == 0) return SimdLevel::SSE2;
+        if (std::strcmp(env, "avx2") == 0) return SimdLevel::AVX2;
+        if (std::strcmp(env, "avx512") == 0) return SimdLevel::AVX512;
+    }
+    return Kernels::detectLevel();
+}
+
+std::atomic<const KernelTable*>& activeTable() {
+    static std::atomic<const KernelTable*> table(
+        tableFor(std::min(requestedLevel(), Kernels::detectLevel())));
+    return table;
+}
+
+inline const KernelTable& kernels() {
+    return *activeTable().load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+double Kernels::dot(const double* x, const double* y, size_t n) {
+    return kernels().dot(x, y, n);
+}
+
+void Kernels::axpy(size_t n, double alpha, const double* x, double* y) {
+    kernels().axpy(n, alpha, x, y);
+}
+
+void Kernels::momentumUpdate(size_t n, double step, double momentum,
+                             double* weights, double* velocity, double* gradient) {
+    kernels().momentumUpdate(n, step, momentum, weights, velocity, gradient);
+}
+
+float Kernels::dot(const float* x, const float* y, size_t n) {
+    return kernels().dotF(x, y, n);
+}
+
+void Kernels::axpy(size_t n, float alpha, const float* x, float* y) {
+    kernels().axpyF(n, alpha, x, y);
+}
+
+void Kernels::momentumUpdate(size_t n, float step, float momentum,
+                             float* weights, float* velocity, float* gradient) {
+    kernels().momentumUpdateF(n, step, momentum, weights, velocity, gradient);
+}
+
+double Kernels::fastExp(double x) {
+    return fastExpScalar(x);
+}
+
+float Kernels::fastExp(float x) {
+    return fastExpScalar(x);
+}
+
+void Kernels::fastSigmoid(const double* x, double* y, size_t n) {
+    kernels().fastSigmoid(x, y, n);
+}
+
+void Kernels::fastTanh(const double* x, double* y, size_t n) {
+    kernels().fastTanh(x, y, n);
+}
+
+void Kernels::fastSigmoid(const float* x, float* y, size_t n) {
+    kernels().fastSigmoidF(x, y, n);
+}
+
+void Kernels::fastTanh(const float* x, float* y, size_t n) {
+    kernels().fastTanhF(x, y, n);
+}
+
+SimdLevel Kernels::detectLevel() {
+#ifdef NEUROUIT_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+SimdLevel Kernels::getLevel() {
+    return kernels().level;
+}
+
+SimdLevel Kernels::setLevel(SimdLevel level) {
+    const KernelTable* table = tableFor(std::min(level, detectLevel()));
+    activeTable().store(table, std::memory_order_relaxed);
+    return table->level;
+}
+
+std::string Kernels::levelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SSE2:
+            return "sse2";
+        case SimdLevel::AVX2:
+            return "avx2";
+        case SimdLevel::AVX512:
+            return "avx512";
+        default:
+            return "scalar";
+    }
+}
+
+} // namespace NeuroUIT
@@ -1,94 +1,272 @@
 #include "core/Layer.h"
+#include "core/ActivationKernels.h"
+#include "core/Kernels.h"
+#include "core/LinearAlgebra.h"
+#include <algorithm>
 #include <stdexcept>
 
 namespace NeuroUIT {
 
-Layer::Layer(size_t numNeurons, size_t numInputs, 
-             std::shared_ptr<ActivationFunction> activation)
-    : numInputs_(numInputs)
-    , outputs_(numNeurons)
-    , prevWeightUpdates_(numNeurons)
+template <typename T>
+BasicLayer<T>::BasicLayer(size_t numNeurons, size_t numInputs,
+                          std::shared_ptr<ActivationFunction> activation)
+    : numNeurons_(numNeurons)
+    , numInputs_(numInputs)
+    , stride_(alignedStride<T>(numInputs))
+    , weights_(numNeurons * stride_, T(0))
+    , biases_(numNeurons, T(0))
+    , weightGradients_(numNeurons * stride_, T(0))
+    , biasGradients_(numNeurons, T(0))
+    , gradientCount_(0)
+    , weightVelocity_(numNeurons * stride_, T(0))
+    , biasVelocity_(numNeurons, T(0))
+    , netInputs_(numNeurons, T(0))
+    , outputs_(numNeurons, T(0))
+    , deltas_(numNeurons, T(0))
+    , activation_(std::move(activation))
+    , activationType_(activation_ ? activation_->getType() : ActivationType::Linear)
+    , activationAccuracy_(ActivationAccuracy::Exact)
 {
-    neurons_.reserve(numNeurons);
-    for (size_t i = 0; i < numNeurons; ++i) {
-        neurons_.emplace_back(numInputs, activation);
-        prevWeightUpdates_[i].resize(numInputs, 0.0);
+}
+
+template <typename T>
+void BasicLayer<T>::initializeWeights(std::mt19937& generator, double mean, double stddev) {
+    for (size_t i = 0; i < numNeurons_; ++i) {
+        // Une distribution par neurone : même séquence de tirages qu'avant le stockage contigu
+        std::normal_distribution<double> dist(mean, stddev);
+        T* row = weights_.data() + i * stride_;
+        for (size_t j = 0; j < numInputs_; ++j) {
+            row[j] = static_cast<T>(dist(generator));
+        }
+        biases_[i] = static_cast<T>(dist(generator));
     }
+
+    // Nouveaux poids : ni momentum ni gradient hérités des anciens
+    std::fill(weightVelocity_.begin(), weightVelocity_.end(), T(0));
+    std::fill(biasVelocity_.begin(), biasVelocity_.end(), T(0));
+    std::fill(weightGradients_.begin(), weightGradients_.end(), T(0));
+    std::fill(biasGradients_.begin(), biasGradients_.end(), T(0));
+    gradientCount_ = 0;
 }
 
-void Layer::initializeWeights(std::mt19937& generator, double mean, double stddev) {
-    for (auto& neuron : neurons_) {
-        neuron.initializeWeights(generator, mean, stddev);
+template <typename T>
+Span<const T> BasicLayer<T>::forward(Span<const T> inputs) {
+    if (inputs.size() != numInputs_) {
+        throw std::invalid_argument("Nombre d'entrées incorrect pour la couche");
+    }
+
+    // Sommes pondérées (sans biais)
+    for (size_t i = 0; i < numNeurons_; ++i) {
+        const T* row = weights_.data() + i * stride_;
+        outputs_[i] = Kernels::dot(inputs.data(), row, numInputs_);
     }
+
+    // Biais et activation sur toute la couche
+    ActivationKernels::activate(activationType_, outputs_.data(), biases_.data(),
+                                outputs_.data(), numNeurons_, netInputs_.data(), activationAccuracy_);
+
+    return Span<const T>(outputs_);
 }
 
-std::vector<double> Layer::forward(const std::vector<double>& inputs) {
+template <typename T>
+void BasicLayer<T>::forward(Span<const T> inputs, Span<T> outputs) const {
     if (inputs.size() != numInputs_) {
         throw std::invalid_argument("Nombre d'entrées incorrect pour la couche");
     }
-    
-    prevInputs_ = inputs;
-    outputs_.resize(neurons_.size());
-    
-    for (size_t i = 0; i < neurons_.size(); ++i) {
-        outputs_[i] = neurons_[i].forward(inputs);
+    if (outputs.size() < numNeurons_) {
+        throw std::invalid_argument("Buffer de sorties trop petit pour la couche");
+    }
+
+    for (size_t i = 0; i < numNeurons_; ++i) {
+        outputs[i] = Kernels::dot(inputs.data(), weights_.data() + i * stride_, numInputs_);
+    }
+
+    ActivationKernels::activate(activationType_, outputs.data(), biases_.data(),
+                                outputs.data(), numNeurons_, static_cast<T*>(nullptr),
+                                activationAccuracy_);
+}
+
+template <typename T>
+void BasicLayer<T>::forwardBatch(BasicMatrixView<T> inputs, BasicMatrix<T>& outputs, BasicMatrix<T>* netInputs) const {
+    if (inputs.getCols() != numInputs_) {
+        throw std::invalid_argument("Nombre d'entrées incorrect pour la couche");
+    }
+
+    size_t batchSize = inputs.getRows();
+    outputs.resize(batchSize, numNeurons_);
+
+    // Sommes pondérées du lot : X · Wᵀ
+    gemmNT(batchSize, numNeurons_, numInputs_,
+           inputs.data(), inputs.getCols(),
+           weights_.data(), stride_,
+           outputs.data(), numNeurons_);
+
+    if (netInputs) {
+        netInputs->resize(batchSize, numNeurons_);
+    }
+
+    // Biais et activation, ligne par ligne
+    for (size_t r = 0; r < batchSize; ++r) {
+        T* row = outputs.row(r);
+        ActivationKernels::activate(activationType_, row, biases_.data(), row, numNeurons_,
+                                    netInputs ? netInputs->row(r) : nullptr, activationAccuracy_);
     }
-    
-    return outputs_;
 }
 
-void Layer::backward(const std::vector<double>& errors, const std::vector<double>& prevLayerOutputs) {
-    (void)prevLayerOutputs; // Utilisé pour la cohérence de l'interface, peut être utilisé dans des implémentations futures
-    if (errors.size() != neurons_.size()) {
+template <typename T>
+void BasicLayer<T>::backward(Span<const T> errors, Span<const T> prevLayerOutputs) {
+    if (errors.size() != numNeurons_) {
         throw std::invalid_argument("Nombre d'erreurs incorrect");
     }
-    
-    for (size_t i = 0; i < neurons_.size(); ++i) {
-        double delta = errors[i];
-        
-        // Multiplier par la dérivée de l'activation
-        if (neurons_[i].getActivation()) {
-            double activationDerivative = neurons_[i].getActivation()->derivative(
-                neurons_[i].getNetInput());
-            delta *= activationDerivative;
-        }
-        
-        neurons_[i].setDelta(delta);
-    }
-}
-
-std::vector<double> Layer::getErrorsForPrevLayer() const {
-    if (neurons_.empty()) {
-        return {};
-    }
-    
-    size_t numPrevNeurons = numInputs_;
-    std::vector<double> errors(numPrevNeurons, 0.0);
-    
-    // Pour chaque neurone de cette couche
-    for (const auto& neuron : neurons_) {
-        const auto& weights = neuron.getWeights();
-        double delta = neuron.getDelta();
-        
-        // Propager l'erreur vers chaque neurone de la couche précédente
-        for (size_t j = 0; j < weights.size() && j < numPrevNeurons; ++j) {
-            errors[j] += weights[j] * delta;
+    if (prevLayerOutputs.size() != numInputs_) {
+        throw std::invalid_argument("Nombre d'entrées incorrect pour mise à jour");
+    }
+
+    // δ = erreurs ⊙ f'(net), f' étant déduite des sorties de la dernière propagation
+    std::copy(errors.begin(), errors.end(), deltas_.begin());
+    ActivationKernels::multiplyDerivative(activationType_, outputs_.data(), deltas_.data(), numNeurons_);
+
+    for (size_t i = 0; i < numNeurons_; ++i) {
+        T delta = deltas_[i];
+
+        // Accumuler le gradient : dW[i] += δ_i · x, db[i] += δ_i
+        Kernels::axpy(numInputs_, delta, prevLayerOutputs.data(),
+                      weightGradients_.data() + i * stride_);
+        biasGradients_[i] += delta;
+    }
+
+    ++gradientCount_;
+}
+
+template <typename T>
+void BasicLayer<T>::backwardBatch(BasicMatrixView<T> inputs, const BasicMatrix<T>& outputs,
+                          BasicMatrix<T>& errors, BasicMatrix<T>* prevErrors) {
+    backwardBatch(inputs, outputs, errors, prevErrors,
+                  weightGradients_.data(), biasGradients_.data());
+    gradientCount_ += inputs.getRows();
+}
+
+template <typename T>
+void BasicLayer<T>::backwardBatch(BasicMatrixView<T> inputs, const BasicMatrix<T>& outputs,
+                          BasicMatrix<T>& errors, BasicMatrix<T>* prevErrors,
+                          T* weightGradients, T* biasGradients) const {
+    size_t batchSize = inputs.getRows();
+    if (inputs.getCols() != numInputs_ ||
+        errors.getCols() != numNeurons_ || errors.getRows() != batchSize ||
+        outputs.getCols() != numNeurons_ || outputs.getRows() != batchSize) {
+        throw std::invalid_argument("Dimensions du lot incorrectes pour la couche");
+    }
+
+    // δ = erreurs ⊙ f'(net), et db += Σ δ
+    for (size_t r = 0; r < batchSize; ++r) {
+        T* deltaRow = errors.row(r);
+        ActivationKernels::multiplyDerivative(activationType_, outputs.row(r), deltaRow, numNeurons_);
+        for (size_t i = 0; i < numNeurons_; ++i) {
+            biasGradients[i] += deltaRow[i];
         }
     }
-    
-    return errors;
+
+    // dW += δᵀ · X
+    gemmTN(numNeurons_, numInputs_, batchSize,
+           errors.data(), numNeurons_,
+           inputs.data(), numInputs_,
+           weightGradients, stride_,
+           true);
+
+    // Erreurs pour la couche précédente : δ · W
+    if (prevErrors) {
+        prevErrors->resize(batchSize, numInputs_);
+        gemmNN(batchSize, numInputs_, numNeurons_,
+               errors.data(), numNeurons_,
+               weights_.data(), stride_,
+               prevErrors->data(), numInputs_);
+    }
 }
 
-void Layer::updateWeights(double learningRate, double momentum) {
-    for (size_t i = 0; i < neurons_.size(); ++i) {
-        neurons_[i].updateWeights(prevInputs_, learningRate, momentum, prevWeightUpdates_[i]);
+template <typename T>
+void BasicLayer<T>::computeErrorsForPrevLayer(Span<T> prevErrors) const {
+    if (prevErrors.size() < numInputs_) {
+        throw std::invalid_argument("Buffer d'erreurs trop petit pour la couche précédente");
+    }
+
+    std::fill(prevErrors.begin(), prevErrors.begin() + numInputs_, T(0));
+
+    // Propager l'erreur de chaque neurone vers la couche précédente
+    // (parcours ligne par ligne de la matrice de poids)
+    for (size_t i = 0; i < numNeurons_; ++i) {
+        Kernels::axpy(numInputs_, deltas_[i], weights_.data() + i * stride_, prevErrors.data());
     }
 }
 
-void Layer::setOutputs(const std::vector<double>& outputs) {
-    outputs_ = outputs;
+template <typename T>
+void BasicLayer<T>::accumulateGradients(const T* weightGradients, const T* biasGradients,
+                                        size_t count) {
+    Kernels::axpy(weightGradients_.size(), T(1), weightGradients, weightGradients_.data());
+    Kernels::axpy(biasGradients_.size(), T(1), biasGradients, biasGradients_.data());
+    gradientCount_ += count;
 }
 
-} // namespace NeuroUIT
+template <typename T>
+void BasicLayer<T>::applyGradients(const T* weightGradients, const T* biasGradients, T step) {
+    Kernels::axpy(weights_.size(), -step, weightGradients, weights_.data());
+    Kernels::axpy(biases_.size(), -step, biasGradients, biases_.data());
+}
 
+template <typename T>
+void BasicLayer<T>::updateWeights(double learningRate, double momentum) {
+    if (gradientCount_ == 0) {
+        return;
+    }
+
+    // Gradient moyen sur les échantillons accumulés
+    T step = static_cast<T>(learningRate / static_cast<double>(gradientCount_));
+    T mu = static_cast<T>(momentum);
 
+    // Descente de gradient avec momentum : v = μ·v - η·g ; w += v
+    // Les colonnes de remplissage restent à zéro, la matrice est donc traitée d'un bloc
+    Kernels::momentumUpdate(weights_.size(), step, mu,
+                            weights_.data(), weightVelocity_.data(), weightGradients_.data());
+    Kernels::momentumUpdate(biases_.size(), step, mu,
+                            biases_.data(), biasVelocity_.data(), biasGradients_.data());
+
+    gradientCount_ = 0;
+}
+
+template <typename T>
+void BasicLayer<T>::setOutputs(Span<const T> outputs) {
+    if (outputs.size() != numNeurons_) {
+        throw std::invalid_argument("Nombre de sorties incorrect pour la couche");
+    }
+    std::copy(outputs.begin(), outputs.end(), outputs_.begin());
+}
+
+template <typename T>
+std::vector<BasicNeuron<T>> BasicLayer<T>::getNeurons() {
+    std::vector<BasicNeuron<T>> neurons;
+    neurons.reserve(numNeurons_);
+    for (size_t i = 0; i < numNeurons_; ++i) {
+        neurons.emplace_back(this, i);
+    }
+    return neurons;
+}
+
+template <typename T>
+const std::vector<BasicNeuron<T>> BasicLayer<T>::getNeurons() const {
+    return const_cast<BasicLayer*>(this)->getNeurons();
+}
+
+template <typename T>
+void BasicLayer<T>::setWeights(size_t neuron, const std::vector<T>& weights) {
+    if (neuron >= numNeurons_) {
+        throw std::out_of_range("Indice de neurone hors limites");
+    }
+    if (weights.size() != numInputs_) {
+        throw std::invalid_argument("Taille des poids incorrecte");
+    }
+    std::copy(weights.begin(), weights.end(), weights_.begin() + neuron * stride_);
+}
+
+template class BasicLayer<float>;
+template class BasicLayer<double>;
+
+} // namespace NeuroUIT
@@ -0,0 +1,199 @@
+#include "core/LinearAlgebra.h"
+#include "core/Kernels.h"
+#include <algorithm>
+
+namespace NeuroUIT {
+
+namespace {
+
+// Tailles de blocs : un bloc de B (kBlockCols x kBlockDepth) tient en L2,
+// quatre lignes de A et de B tiennent en L1
+constexpr size_t kBlockRows = 64;   // Lignes de A par bloc (échantillons)
+constexpr size_t kBlockCols = 64;   // Lignes de B par bloc (neurones)
+constexpr size_t kBlockDepth = 256; // Profondeur par bloc (entrées)
+
+/**
+ * @brief Micro-noyau 4x4 : accumule 16 produits scalaires partiels en registres
+ */
+template <typename T>
+inline void microKernel4x4(size_t depth,
+                           const T* a, size_t lda,
+                           const T* b, size_t ldb,
+                           T* c, size_t ldc) {
+    T c00 = 0, c01 = 0, c02 = 0, c03 = 0;
+    T c10 = 0, c11 = 0, c12 = 0, c13 = 0;
+    T c20 = 0, c21 = 0, c22 = 0, c23 = 0;
+    T c30 = 0, c31 = 0, c32 = 0, c33 = 0;
+
+    const T* a0 = a;
+    const T* a1 = a + lda;
+    const T* a2 = a + 2 * lda;
+    const T* a3 = a + 3 * lda;
+    const T* b0 = b;
+    const T* b1 = b + ldb;
+    const T* b2 = b + 2 * ldb;
+    const T* b3 = b + 3 * ldb;
+
+    for (size_t p = 0; p < depth; ++p) {
+        T av0 = a0[p], av1 = a1[p], av2 = a2[p], av3 = a3[p];
+        T bv0 = b0[p], bv1 = b1[p], bv2 = b2[p], bv3 = b3[p];
+        c00 += av0 * bv0; c01 += av0 * bv1; c02 += av0 * bv2; c03 += av0 * bv3;
+        c10 += av1 * bv0; c11 += av1 * bv1; c12 += av1 * bv2; c13 += av1 * bv3;
+        c20 += av2 * bv0; c21 += av2 * bv1; c22 += av2 * bv2; c23 += av2 * bv3;
+        c30 += av3 * bv0; c31 += av3 * bv1; c32 += av3 * bv2; c33 += av3 * bv3;
+    }
+
+    c[0] += c00; c[1] += c01; c[2] += c02; c[3] += c03;
+    c += ldc;
+    c[0] += c10; c[1] += c11; c[2] += c12; c[3] += c13;
+    c += ldc;
+    c[0] += c20; c[1] += c21; c[2] += c22; c[3] += c23;
+    c += ldc;
+    c[0] += c30; c[1] += c31; c[2] += c32; c[3] += c33;
+}
+
+/**
+ * @brief Cas général pour les bords de bloc (moins de 4 lignes ou colonnes)
+ */
+template <typename T>
+inline void edgeKernel(size_t rows, size_t cols, size_t depth,
+                       const T* a, size_t lda,
+                       const T* b, size_t ldb,
+                       T* c, size_t ldc) {
+    for (size_t i = 0; i < rows; ++i) {
+        const T* ai = a + i * lda;
+        for (size_t j = 0; j < cols; ++j) {
+            c[i * ldc + j] += Kernels::dot(ai, b + j * ldb, depth);
+        }
+    }
+}
+
+/**
+ * @brief Met à zéro un bloc m x n de C
+ */
+template <typename T>
+inline void clearMatrix(size_t m, size_t n, T* c, size_t ldc) {
+    for (size_t i = 0; i < m; ++i) {
+        std::fill(c + i * ldc, c + i * ldc + n, T(0));
+    }
+}
+
+} // namespace
+
+template <typename T>
+void gemmNT(size_t m, size_t n, size_t k,
+            const T* a, size_t lda,
+            const T* b, size_t ldb,
+            T* c, size_t ldc,
+            bool accumulate) {
+    if (!accumulate) {
+        clearMatrix(m, n, c, ldc);
+    }
+
+    for (size_t p0 = 0; p0 < k; p0 += kBlockDepth) {
+        size_t depth = std::min(kBlockDepth, k - p0);
+
+        for (size_t j0 = 0; j0 < n; j0 += kBlockCols) {
+            size_t jEnd = std::min(j0 + kBlockCols, n);
+
+            for (size_t i0 = 0; i0 < m; i0 += kBlockRows) {
+                size_t iEnd = std::min(i0 + kBlockRows, m);
+
+                size_t i = i0;
+                for (; i + 4 <= iEnd; i += 4) {
+                    size_t j = j0;
+                    for (; j + 4 <= jEnd; j += 4) {
+                        microKernel4x4(depth,
+                                       a + i * lda + p0, lda,
+                                       b + j * ldb + p0, ldb,
+                                       c + i * ldc + j, ldc);
+                    }
+                    if (j < jEnd) {
+                        edgeKernel(4, jEnd - j, depth,
+                                   a + i * lda + p0, lda,
+                                   b + j * ldb + p0, ldb,
+                                   c + i * ldc + j, ldc);
+                    }
+                }
+                if (i < iEnd) {
+                    edgeKernel(iEnd - i, jEnd - j0, depth,
+                               a + i * lda + p0, lda,
+                               b + j0 * ldb + p0, ldb,
+                               c + i * ldc + j0, ldc);
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void gemmNN(size_t m, size_t n, size_t k,
+            const T* a, size_t lda,
+            const T* b, size_t ldb,
+            T* c, size_t ldc,
+            bool accumulate) {
+    if (!accumulate) {
+        clearMatrix(m, n, c, ldc);
+    }
+
+    // C[i, :] += A[i, p] * B[p, :] : le bloc de B est réutilisé pour toutes les lignes de A
+    for (size_t j0 = 0; j0 < n; j0 += kBlockDepth) {
+        size_t width = std::min(kBlockDepth, n - j0);
+
+        for (size_t p0 = 0; p0 < k; p0 += kBlockCols) {
+            size_t pEnd = std::min(p0 + kBlockCols, k);
+
+            for (size_t i = 0; i < m; ++i) {
+                const T* ai = a + i * lda;
+                T* ci = c + i * ldc + j0;
+                for (size_t p = p0; p < pEnd; ++p) {
+                    Kernels::axpy(width, ai[p], b + p * ldb + j0, ci);
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void gemmTN(size_t m, size_t n, size_t k,
+            const T* a, size_t lda,
+            const T* b, size_t ldb,
+            T* c, size_t ldc,
+            bool accumulate) {
+    if (!accumulate) {
+        clearMatrix(m, n, c, ldc);
+    }
+
+    // C[i, :] += A[p, i] * B[p, :] : le bloc de C reste en cache pendant tout le lot
+    for (size_t j0 = 0; j0 < n; j0 += kBlockDepth) {
+        size_t width = std::min(kBlockDepth, n - j0);
+
+        for (size_t i0 = 0; i0 < m; i0 += kBlockRows) {
+            size_t iEnd = std::min(i0 + kBlockRows, m);
+
+            for (size_t p = 0; p < k; ++p) {
+                const T* ap = a + p * lda;
+                const T* bp = b + p * ldb + j0;
+                for (size_t i = i0; i < iEnd; ++i) {
+                    Kernels::axpy(width, ap[i], bp, c + i * ldc + j0);
+                }
+            }
+        }
+    }
+}
+
+// Instanciations explicites pour les deux précisions supportées
+#define NEUROUIT_INSTANTIATE_GEMM(T)                                              \
+    template void gemmNT<T>(size_t, size_t, size_t, const T*, size_t,             \
+                            const T*, size_t, T*, size_t, bool);                 \
+    template void gemmNN<T>(size_t, size_t, size_t, const T*, size_t,             \
+                            const T*, size_t, T*, size_t, bool);                 \
+    template void gemmTN<T>(size_t, size_t, size_t, const T*, size_t,             \
+                            const T*, size_t, T*, size_t, bool);
+
+NEUROUIT_INSTANTIATE_GEMM(float)
+NEUROUIT_INSTANTIATE_GEMM(double)
+
+#undef NEUROUIT_INSTANTIATE_GEMM
+
+} // namespace NeuroUIT
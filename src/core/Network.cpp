@@ -8,21 +8,28 @@
 
 namespace NeuroUIT {
 
-Network::Network()
-    : generator_(std::random_device{}())
+template <typename T>
+BasicNetwork<T>::BasicNetwork()
+    : activationAccuracy_(ActivationAccuracy::Exact)
+    , version_(0)
+    , generator_(std::random_device{}())
 {
 }
 
-Network::Network(const std::vector<size_t>& architecture,
-                 const std::vector<ActivationType>& activations)
+template <typename T>
+BasicNetwork<T>::BasicNetwork(const std::vector<size_t>& architecture,
+                              const std::vector<ActivationType>& activations)
     : activationTypes_(activations)
+    , activationAccuracy_(ActivationAccuracy::Exact)
+    , version_(0)
     , generator_(std::random_device{}())
 {
     createLayers(architecture, activations);
     initializeWeights();
 }
 
-void Network::createLayers(const std::vector<size_t>& architecture,
+template <typename T>
+void BasicNetwork<T>::createLayers(const std::vector<size_t>& architecture,
                            const std::vector<ActivationType>& activations) {
     if (architecture.empty()) {
         throw std::invalid_argument("L'architecture ne peut pas être vide");
@@ -47,10 +54,14 @@ void Network::createLayers(const std::vector<size_t>& architecture,
         
         auto activation = ActivationFunction::create(activationType);
         layers_.emplace_back(architecture[i], numInputsForLayer, std::move(activation));
+        layers_.back().setActivationAccuracy(activationAccuracy_);
     }
+    
+    workspace_ = Workspace(architecture);
 }
 
-void Network::initializeWeights(unsigned int seed) {
+template <typename T>
+void BasicNetwork<T>::initializeWeights(unsigned int seed) {
     generator_.seed(seed);
     
     // Initialisation Xavier/Glorot pour chaque couche
@@ -64,9 +75,11 @@ void Network::initializeWeights(unsigned int seed) {
         
         layers_[i].initializeWeights(generator_, 0.0, stddev);
     }
+    ++version_;
 }
 
-std::vector<double> Network::forward(const std::vector<double>& inputs) {
+template <typename T>
+Span<const T> BasicNetwork<T>::forward(Span<const T> inputs) {
     if (layers_.empty()) {
         throw std::runtime_error("Le réseau n'a pas de couches");
     }
@@ -75,68 +88,252 @@ std::vector<double> Network::forward(const std::vector<double>& inputs) {
         throw std::invalid_argument("Nombre d'entrées incorrect");
     }
     
-    // Propagation avant à travers toutes les couches
-    std::vector<double> currentOutputs = inputs;
+    // Couche d'entrée : juste passer les valeurs
+    layers_[0].setOutputs(inputs);
     
-    for (size_t i = 0; i < layers_.size(); ++i) {
-        if (i == 0) {
-            // Couche d'entrée : juste passer les valeurs
-            layers_[i].setOutputs(inputs);
-            currentOutputs = inputs;
-        } else {
-            // Couches suivantes : propagation
-            currentOutputs = layers_[i].forward(currentOutputs);
-        }
+    // Couches suivantes : chaque couche lit directement les sorties de la précédente
+    Span<const T> currentOutputs(layers_[0].getOutputs());
+    for (size_t i = 1; i < layers_.size(); ++i) {
+        currentOutputs = layers_[i].forward(currentOutputs);
     }
     
-    lastOutput_ = currentOutputs;
     return currentOutputs;
 }
 
-double Network::backward(const std::vector<double>& targets) {
+template <typename T>
+std::vector<T> BasicNetwork<T>::forward(const std::vector<T>& inputs) {
+    Span<const T> outputs = forward(Span<const T>(inputs));
+    return std::vector<T>(outputs.begin(), outputs.end());
+}
+
+template <typename T>
+Span<const T> BasicNetwork<T>::predict(Span<const T> inputs, Workspace& workspace) const {
     if (layers_.empty()) {
         throw std::runtime_error("Le réseau n'a pas de couches");
     }
     
-    if (targets.size() != lastOutput_.size()) {
+    if (inputs.size() != layers_[0].getNumNeurons()) {
+        throw std::invalid_argument("Nombre d'entrées incorrect");
+    }
+    
+    checkWorkspace(workspace);
+    
+    // Les couches alternent entre les deux zones d'activations du workspace
+    Span<const T> current = inputs;
+    for (size_t i = 1; i < layers_.size(); ++i) {
+        Span<T> next(workspace.activations(i % 2).data(), layers_[i].getNumNeurons());
+        layers_[i].forward(current, next);
+        current = next;
+    }
+    
+    return current;
+}
+
+template <typename T>
+BasicMatrixView<T> BasicNetwork<T>::forwardBatch(MatrixView inputs, Workspace& workspace) const {
+    if (layers_.empty()) {
+        throw std::runtime_error("Le réseau n'a pas de couches");
+    }
+
+    if (inputs.getCols() != layers_[0].getNumNeurons()) {
+        throw std::invalid_argument("Nombre d'entrées incorrect");
+    }
+
+    checkWorkspace(workspace);
+
+    if (layers_.size() == 1) {
+        return inputs;
+    }
+
+    // Sorties de chaque couche dans les matrices préréservées du workspace
+    for (size_t i = 1; i < layers_.size(); ++i) {
+        MatrixView layerInputs = (i == 1) ? inputs : MatrixView(workspace.batchOutputs(i - 1));
+        layers_[i].forwardBatch(layerInputs, workspace.batchOutputs(i));
+    }
+
+    return workspace.batchOutputs(layers_.size() - 1);
+}
+
+template <typename T>
+void BasicNetwork<T>::checkWorkspace(const Workspace& workspace) const {
+    const std::vector<size_t>& shape = workspace.getArchitecture();
+    bool compatible = shape.size() == layers_.size();
+    for (size_t i = 0; compatible && i < layers_.size(); ++i) {
+        compatible = shape[i] == layers_[i].getNumNeurons();
+    }
+    if (!compatible) {
+        throw std::invalid_argument("Workspace incompatible avec l'architecture du réseau");
+    }
+}
+
+template <typename T>
+BasicMatrix<T> BasicNetwork<T>::forwardBatch(MatrixView inputs) const {
+    Workspace workspace = createWorkspace(inputs.getRows());
+    MatrixView outputs = forwardBatch(inputs, workspace);
+    Matrix result(outputs.getRows(), outputs.getCols());
+    std::copy(outputs.data(), outputs.data() + outputs.getRows() * outputs.getCols(), result.data());
+    return result;
+}
+
+template <typename T>
+double BasicNetwork<T>::backward(Span<const T> targets) {
+    if (layers_.empty()) {
+        throw std::runtime_error("Le réseau n'a pas de couches");
+    }
+    
+    Span<const T> lastOutput = getLastOutput();
+    if (targets.size() != lastOutput.size()) {
         throw std::invalid_argument("Nombre de sorties cibles incorrect");
     }
     
     // Calculer l'erreur de la couche de sortie
-    std::vector<double> outputErrors(lastOutput_.size());
-    for (size_t i = 0; i < lastOutput_.size(); ++i) {
-        outputErrors[i] = lastOutput_[i] - targets[i];
+    Span<T> currentErrors(workspace_.errors().data(), lastOutput.size());
+    for (size_t i = 0; i < lastOutput.size(); ++i) {
+        currentErrors[i] = lastOutput[i] - targets[i];
     }
     
     // Rétropropagation de la couche de sortie vers l'entrée
-    std::vector<double> currentErrors = outputErrors;
-    
-    for (int i = static_cast<int>(layers_.size()) - 1; i >= 1; --i) {
-        // Obtenir les sorties de la couche précédente
-        std::vector<double> prevOutputs = (i > 1) 
-            ? layers_[i - 1].getOutputs() 
-            : layers_[0].getOutputs();
-        
-        // Calculer les erreurs pour cette couche
-        layers_[i].backward(currentErrors, prevOutputs);
+    for (size_t i = layers_.size() - 1; i >= 1; --i) {
+        // Calculer les erreurs pour cette couche (entrées = sorties de la couche précédente)
+        layers_[i].backward(currentErrors, layers_[i - 1].getOutputs());
         
         // Propager les erreurs vers la couche précédente
         if (i > 1) {
-            currentErrors = layers_[i].getErrorsForPrevLayer();
+            Span<T> prevErrors(workspace_.prevErrors().data(), layers_[i].getNumInputs());
+            layers_[i].computeErrorsForPrevLayer(prevErrors);
+            workspace_.swapErrors();
+            currentErrors = prevErrors;
         }
     }
     
     // Retourner l'erreur quadratique moyenne
-    return computeMeanSquaredError(lastOutput_, targets);
+    return computeMeanSquaredError(lastOutput, targets);
 }
 
-void Network::updateWeights(double learningRate, double momentum) {
+template <typename T>
+double BasicNetwork<T>::backwardBatch(MatrixView inputs, MatrixView targets) {
+    workspace_.reserveBatch(inputs.getRows());
+    return backpropagateBatch(inputs, targets, workspace_,
+        [this](size_t i, MatrixView layerInputs, const Matrix& outputs,
+               Matrix& errors, Matrix* prevErrors) {
+            layers_[i].backwardBatch(layerInputs, outputs, errors, prevErrors);
+        });
+}
+
+template <typename T>
+double BasicNetwork<T>::backwardBatch(MatrixView inputs, MatrixView targets,
+                                      Workspace& workspace, Gradients& gradients) const {
+    checkWorkspace(workspace);
+    workspace.reserveBatch(inputs.getRows());
+    double error = backpropagateBatch(inputs, targets, workspace,
+        [this, &gradients](size_t i, MatrixView layerInputs, const Matrix& outputs,
+                           Matrix& errors, Matrix* prevErrors) {
+            layers_[i].backwardBatch(layerInputs, outputs, errors, prevErrors,
+                                     gradients.weights(i), gradients.biases(i));
+        });
+    gradients.setCount(gradients.getCount() + inputs.getRows());
+    return error;
+}
+
+template <typename T>
+template <typename LayerBackward>
+double BasicNetwork<T>::backpropagateBatch(MatrixView inputs, MatrixView targets,
+                                           Workspace& workspace,
+                                           LayerBackward layerBackward) const {
+    if (layers_.size() < 2) {
+        throw std::runtime_error("Le réseau n'a pas de couches");
+    }
+    
+    size_t batchSize = inputs.getRows();
+    size_t numOutputs = layers_.back().getNumNeurons();
+    if (inputs.getCols() != layers_[0].getNumNeurons()) {
+        throw std::invalid_argument("Nombre d'entrées incorrect");
+    }
+    if (targets.getRows() != batchSize || targets.getCols() != numOutputs) {
+        throw std::invalid_argument("Nombre de sorties cibles incorrect");
+    }
+    if (batchSize == 0) {
+        return 0.0;
+    }
+    
+    // Propagation avant en conservant les activations de chaque couche
+    for (size_t i = 1; i < layers_.size(); ++i) {
+        MatrixView layerInputs = (i == 1) ? inputs : MatrixView(workspace.batchOutputs(i - 1));
+        layers_[i].forwardBatch(layerInputs, workspace.batchOutputs(i));
+    }
+    
+    // Erreur de la couche de sortie
+    const Matrix& outputs = workspace.batchOutputs(layers_.size() - 1);
+    Matrix* errors = &workspace.batchErrors();
+    Matrix* prevErrors = &workspace.batchPrevErrors();
+    errors->resize(batchSize, numOutputs);
+    double sumSquaredError = 0.0;
+    for (size_t r = 0; r < batchSize; ++r) {
+        const T* outputRow = outputs.row(r);
+        const T* targetRow = targets.row(r);
+        T* errorRow = errors->row(r);
+        for (size_t j = 0; j < numOutputs; ++j) {
+            errorRow[j] = outputRow[j] - targetRow[j];
+            sumSquaredError += errorRow[j] * errorRow[j];
+        }
+    }
+    
+    // Rétropropagation de la couche de sortie vers l'entrée
+    for (size_t i = layers_.size() - 1; i >= 1; --i) {
+        MatrixView layerInputs = (i == 1) ? inputs : MatrixView(workspace.batchOutputs(i - 1));
+        layerBackward(i, layerInputs, workspace.batchOutputs(i), *errors,
+                      (i > 1) ? prevErrors : nullptr);
+        std::swap(errors, prevErrors);
+    }
+    
+    return sumSquaredError / static_cast<double>(batchSize * numOutputs);
+}
+
+template <typename T>
+void BasicNetwork<T>::accumulateGradients(const Gradients& gradients) {
+    for (size_t i = 1; i < layers_.size(); ++i) {
+        layers_[i].accumulateGradients(gradients.weights(i), gradients.biases(i),
+                                       gradients.getCount());
+    }
+}
+
+template <typename T>
+void BasicNetwork<T>::updateWeights(double learningRate, double momentum) {
     for (size_t i = 1; i < layers_.size(); ++i) {
         layers_[i].updateWeights(learningRate, momentum);
     }
+    ++version_;
+}
+
+template <typename T>
+BasicWorkspace<T> BasicNetwork<T>::createWorkspace(size_t batchCapacity) const {
+    return Workspace(getArchitecture(), batchCapacity);
+}
+
+template <typename T>
+void BasicNetwork<T>::applyGradients(const Gradients& gradients, double learningRate) {
+    if (gradients.getCount() == 0) {
+        return;
+    }
+    T step = static_cast<T>(learningRate / static_cast<double>(gradients.getCount()));
+    for (size_t i = 1; i < layers_.size(); ++i) {
+        layers_[i].applyGradients(gradients.weights(i), gradients.biases(i), step);
+    }
 }
 
-std::vector<size_t> Network::getArchitecture() const {
+template <typename T>
+BasicGradients<T> BasicNetwork<T>::createGradients() const {
+    std::vector<size_t> weightSizes;
+    std::vector<size_t> biasSizes;
+    for (const auto& layer : layers_) {
+        weightSizes.push_back(layer.getNumNeurons() * layer.getWeightStride());
+        biasSizes.push_back(layer.getNumNeurons());
+    }
+    return Gradients(weightSizes, biasSizes);
+}
+
+template <typename T>
+std::vector<size_t> BasicNetwork<T>::getArchitecture() const {
     std::vector<size_t> architecture;
     for (const auto& layer : layers_) {
         architecture.push_back(layer.getNumNeurons());
@@ -144,8 +341,8 @@ std::vector<size_t> Network::getArchitecture() const {
     return architecture;
 }
 
-double Network::computeMeanSquaredError(const std::vector<double>& predictions,
-                                       const std::vector<double>& targets) {
+template <typename T>
+double BasicNetwork<T>::computeMeanSquaredError(Span<const T> predictions, Span<const T> targets) {
     if (predictions.size() != targets.size()) {
         throw std::invalid_argument("Les tailles des vecteurs doivent être identiques");
     }
@@ -156,20 +353,32 @@ double Network::computeMeanSquaredError(const std::vector<double>& predictions,
     
     double sumSquaredError = 0.0;
     for (size_t i = 0; i < predictions.size(); ++i) {
-        double error = predictions[i] - targets[i];
+        double error = static_cast<double>(predictions[i]) - static_cast<double>(targets[i]);
         sumSquaredError += error * error;
     }
     
     return sumSquaredError / static_cast<double>(predictions.size());
 }
 
-std::vector<std::vector<std::vector<double>>> Network::getAllWeights() const {
-    std::vector<std::vector<std::vector<double>>> allWeights;
+template <typename T>
+void BasicNetwork<T>::setActivationAccuracy(ActivationAccuracy accuracy) {
+    activationAccuracy_ = accuracy;
+    for (auto& layer : layers_) {
+        layer.setActivationAccuracy(accuracy);
+    }
+    ++version_;
+}
+
+template <typename T>
+typename BasicNetwork<T>::WeightTensor BasicNetwork<T>::getAllWeights() const {
+    WeightTensor allWeights;
     
     for (const auto& layer : layers_) {
-        std::vector<std::vector<double>> layerWeights;
-        for (const auto& neuron : layer.getNeurons()) {
-            layerWeights.push_back(neuron.getWeights());
+        std::vector<std::vector<T>> layerWeights;
+        layerWeights.reserve(layer.getNumNeurons());
+        for (size_t j = 0; j < layer.getNumNeurons(); ++j) {
+            auto weights = layer.getWeights(j);
+            layerWeights.emplace_back(weights.begin(), weights.end());
         }
         allWeights.push_back(layerWeights);
     }
@@ -177,7 +386,8 @@ std::vector<std::vector<std::vector<double>>> Network::getAllWeights() const {
     return allWeights;
 }
 
-void Network::setAllWeights(const std::vector<std::vector<std::vector<double>>>& weights) {
+template <typename T>
+void BasicNetwork<T>::setAllWeights(const WeightTensor& weights) {
     if (weights.size() != layers_.size()) {
         throw std::invalid_argument("Nombre de couches incorrect");
     }
@@ -188,16 +398,20 @@ void Network::setAllWeights(const std::vector<std::vector<std::vector<double>>>&
             throw std::invalid_argument("Nombre de neurones incorrect pour la couche " + std::to_string(i));
         }
         
-        auto& neurons = layer.getNeurons();
-        for (size_t j = 0; j < neurons.size(); ++j) {
-            neurons[j].setWeights(weights[i][j]);
+        for (size_t j = 0; j < layer.getNumNeurons(); ++j) {
+            layer.setWeights(j, weights[i][j]);
         }
     }
+    ++version_;
 }
 
-std::vector<ActivationType> Network::getActivationTypes() const {
+template <typename T>
+std::vector<ActivationType> BasicNetwork<T>::getActivationTypes() const {
     return activationTypes_;
 }
 
+template class BasicNetwork<float>;
+template class BasicNetwork<double>;
+
 } // namespace NeuroUIT
 
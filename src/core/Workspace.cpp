@@ -0,0 +1,45 @@
+#include "core/Workspace.h"
+#include <algorithm>
+
+namespace NeuroUIT {
+
+template <typename T>
+BasicWorkspace<T>::BasicWorkspace()
+    : maxWidth_(0)
+    , errorStride_(0)
+    , batchCapacity_(0)
+    , current_(0)
+{
+}
+
+template <typename T>
+BasicWorkspace<T>::BasicWorkspace(const std::vector<size_t>& architecture, size_t batchCapacity)
+    : architecture_(architecture)
+    , maxWidth_(architecture.empty() ? 0 : *std::max_element(architecture.begin(), architecture.end()))
+    , errorStride_(alignedStride<T>(maxWidth_))
+    , batchCapacity_(0)
+    , current_(0)
+    , arena_(4 * errorStride_, T(0))
+    , batchOutputs_(architecture.size())
+{
+    reserveBatch(batchCapacity);
+}
+
+template <typename T>
+void BasicWorkspace<T>::reserveBatch(size_t batchCapacity) {
+    if (batchCapacity <= batchCapacity_) {
+        return;
+    }
+    batchCapacity_ = batchCapacity;
+
+    for (size_t i = 0; i < architecture_.size(); ++i) {
+        batchOutputs_[i].reserve(batchCapacity * architecture_[i]);
+    }
+    batchErrors_.reserve(batchCapacity * maxWidth_);
+    batchPrevErrors_.reserve(batchCapacity * maxWidth_);
+}
+
+template class BasicWorkspace<float>;
+template class BasicWorkspace<double>;
+
+} // namespace NeuroUIT
@@ -1,180 +1,627 @@
 #include "dataset/DatasetManager.h"
+#include "concurrency/ThreadPool.h"
+#include "dataset/DatasetView.h"
 #include <fstream>
-#include <sstream>
+#include <charconv>
+#include <cctype>
+#include <cstring>
 #include <algorithm>
 #include <numeric>
 #include <cmath>
 #include <stdexcept>
 #include <limits>
+#include <map>
 #include <random>
 
 namespace NeuroUIT {
 
+namespace {
+
+// Taille des blocs lus depuis le disque
+constexpr size_t CSV_BLOCK_SIZE = size_t(32) << 20;
+
+// Taille minimale d'un morceau confié à un thread d'analyse
+constexpr size_t CSV_MIN_CHUNK_SIZE = size_t(1) << 20;
+
+inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool isBlankLine(const char* begin, const char* end) {
+    for (; begin != end; ++begin) {
+        if (!isBlank(*begin)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const char* findChar(const char* begin, const char* end, char c) {
+    const void* found = std::memchr(begin, c, static_cast<size_t>(end - begin));
+    return found ? static_cast<const char*>(found) : end;
+}
+
+/**
+ * @brief Mélange de Fisher-Yates reproductible
+ * Contrairement à std::shuffle, le résultat ne dépend que de la graine de
+ * mt19937 (spécifié par la norme), pas de l'implémentation de la bibliothèque
+ */
+void shuffleIndices(std::vector<uint32_t>& indices, std::mt19937& generator) {
+    for (size_t i = indices.size(); i > 1; --i) {
+        size_t j = generator() % i;
+        std::swap(indices[i - 1], indices[j]);
+    }
+}
+
+inline const char* nextLine(const char* lineEnd, const char* end) {
+    return lineEnd == end ? end : lineEnd + 1;
+}
+
+size_t countCSVRows(const char* begin, const char* end) {
+    size_t rows = 0;
+    while (begin != end) {
+        const char* lineEnd = findChar(begin, end, '\n');
+        if (!isBlankLine(begin, lineEnd)) {
+            ++rows;
+        }
+        begin = nextLine(lineEnd, end);
+    }
+    return rows;
+}
+
+std::vector<std::string> parseCSVHeader(const char* begin, const char* end) {
+    std::vector<std::string> names;
+    while (true) {
+        const char* fieldEnd = findChar(begin, end, ',');
+        const char* first = begin;
+        const char* last = fieldEnd;
+        while (first != last && isBlank(*first)) {
+            ++first;
+        }
+        while (last != first && isBlank(last[-1])) {
+            --last;
+        }
+        names.emplace_back(first, last);
+        if (fieldEnd == end) {
+            break;
+        }
+        begin = fieldEnd + 1;
+    }
+    return names;
+}
+
+// Format binaire .nuid
+constexpr char BINARY_MAGIC[4] = {'N', 'U', 'I', 'D'};
+constexpr uint32_t BINARY_DTYPE_FLOAT64 = 1;
+constexpr uint64_t BINARY_ALIGNMENT = 64;
+
+/**
+ * @brief En-tête fixe d'un fichier .nuid
+ */
+struct BinaryHeader {
+    char magic[4];          // "NUID"
+    uint32_t version;       // DatasetManager::BINARY_VERSION
+    uint32_t dtype;         // Type des valeurs (BINARY_DTYPE_FLOAT64)
+    uint32_t reserved;      // Toujours 0
+    uint64_t numSamples;    // Nombre d'échantillons
+    uint64_t numInputs;     // Nombre d'entrées par échantillon
+    uint64_t numOutputs;    // Nombre de sorties par échantillon
+    uint64_t namesSize;     // Taille du bloc de noms de colonnes (octets)
+    uint64_t inputOffset;   // Position du bloc d'entrées
+    uint64_t outputOffset;  // Position du bloc de sorties
+    uint64_t checksum;      // FNV-1a des blocs d'entrées puis de sorties
+};
+
+static_assert(sizeof(BinaryHeader) == 72, "En-tête .nuid sans remplissage attendu");
+
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+/**
+ * @brief FNV-1a 64 bits, appliqué par mots de 8 octets (les blocs sont des doubles)
+ */
+uint64_t fnv1a(const unsigned char* data, size_t size, uint64_t hash = FNV_OFFSET_BASIS) {
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash ^= word;
+        hash *= FNV_PRIME;
+    }
+    for (; i < size; ++i) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+inline uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void writePadding(std::ofstream& file, uint64_t count) {
+    static const char zeros[BINARY_ALIGNMENT] = {};
+    file.write(zeros, static_cast<std::streamsize>(count));
+}
+
+/**
+ * @brief Exécute function(0..numChunks-1), sur le pool s'il y en a un
+ */
+template <typename Function>
+void runChunks(ThreadPool* pool, size_t numChunks, const Function& function) {
+    if (!pool) {
+        for (size_t c = 0; c < numChunks; ++c) {
+            function(c);
+        }
+        return;
+    }
+    pool->parallelFor(0, numChunks, 1, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c) {
+            function(c);
+        }
+    });
+}
+
+} // namespace
+
 DatasetManager::DatasetManager()
-    : numInputs_(0)
+    : inputData_(nullptr)
+    , outputData_(nullptr)
+    , numSamples_(0)
+    , numInputs_(0)
     , numOutputs_(0)
+    , threadPool_(nullptr)
 {
 }
 
 bool DatasetManager::loadFromCSV(const std::string& filename, 
                                 size_t numInputs, 
                                 size_t numOutputs,
-                                bool hasHeader) {
+                                bool hasHeader,
+                                size_t numThreads) {
     clear();
     
     numInputs_ = numInputs;
     numOutputs_ = numOutputs;
     
-    std::ifstream file(filename);
+    std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         return false;
     }
     
-    std::string line;
+    // Taille inconnue (tube, /dev/stdin) : blocs de taille fixe, sans réservation
+    file.seekg(0, std::ios::end);
+    std::streamoff endPosition = file.tellg();
+    bool sizeKnown = endPosition >= 0;
+    size_t fileSize = sizeKnown ? static_cast<size_t>(endPosition) : 0;
+    file.clear();
+    file.seekg(0, std::ios::beg);
+    file.clear();
     
-    // Ignorer l'en-tête si présent
-    if (hasHeader && std::getline(file, line)) {
-        // Ignorer la première ligne
+    if (numThreads == 0) {
+        numThreads = threadPool_ ? threadPool_->getConcurrency() : 1;
     }
     
-    // Lire les données
-    while (std::getline(file, line)) {
-        if (line.empty() || line.find_first_not_of(" \t\n\r") == std::string::npos) {
-            continue; // Ignorer les lignes vides
+    inputs_.resize(0, numInputs);
+    outputs_.resize(0, numOutputs);
+    
+    size_t blockSize = sizeKnown ? std::min(CSV_BLOCK_SIZE, fileSize + 1) : CSV_BLOCK_SIZE;
+    std::vector<char> buffer;
+    size_t pending = 0;         // Octets d'une ligne incomplète en tête de buffer
+    bool skipHeader = hasHeader;
+    bool reserved = false;
+    
+    std::vector<const char*> bounds;
+    std::vector<size_t> firstRows;
+    std::vector<char> chunkValid;
+    
+    while (true) {
+        buffer.resize(pending + blockSize);
+        file.read(buffer.data() + pending, static_cast<std::streamsize>(blockSize));
+        size_t bytesRead = static_cast<size_t>(file.gcount());
+        bool atEnd = bytesRead < blockSize;
+        
+        const char* begin = buffer.data();
+        const char* end = begin + pending + bytesRead;
+        
+        // Ne traiter que des lignes complètes ; le reste attend le bloc suivant
+        const char* complete = end;
+        if (!atEnd) {
+            const char* lastNewline = end;
+            while (lastNewline != begin && lastNewline[-1] != '\n') {
+                --lastNewline;
+            }
+            if (lastNewline == begin) {
+                // Ligne plus longue que le buffer : l'agrandir
+                pending += bytesRead;
+                continue;
+            }
+            complete = lastNewline;
         }
         
-        std::vector<double> values = parseCSVLine(line);
+        // Conserver les noms de colonnes de l'en-tête si présent
+        if (skipHeader) {
+            const char* headerEnd = findChar(begin, complete, '\n');
+            columnNames_ = parseCSVHeader(begin, headerEnd);
+            begin = nextLine(headerEnd, complete);
+            skipHeader = false;
+        }
         
-        if (values.size() != numInputs + numOutputs) {
-            // Erreur de format
-            clear();
-            return false;
+        // Découper aux fins de ligne en morceaux de taille comparable
+        size_t length = static_cast<size_t>(complete - begin);
+        size_t numChunks = std::max<size_t>(1, std::min(numThreads, length / CSV_MIN_CHUNK_SIZE));
+        bounds.assign(numChunks + 1, complete);
+        bounds[0] = begin;
+        for (size_t c = 1; c < numChunks; ++c) {
+            const char* target = std::max(begin + c * length / numChunks, bounds[c - 1]);
+            bounds[c] = nextLine(findChar(target, complete, '\n'), complete);
+        }
+        
+        // Compter les lignes de chaque morceau pour placer ses résultats
+        firstRows.assign(numChunks + 1, 0);
+        runChunks(threadPool_, numChunks, [&](size_t c) {
+            firstRows[c + 1] = countCSVRows(bounds[c], bounds[c + 1]);
+        });
+        firstRows[0] = inputs_.getRows();
+        std::partial_sum(firstRows.begin(), firstRows.end(), firstRows.begin());
+        
+        size_t totalRows = firstRows[numChunks];
+        if (sizeKnown && !reserved && !atEnd && totalRows > 0) {
+            // Estimer le nombre total de lignes d'après le premier bloc
+            double scale = static_cast<double>(fileSize)
+                         / static_cast<double>(complete - buffer.data());
+            size_t estimate = static_cast<size_t>(totalRows * scale * 1.0625) + 1;
+            inputs_.reserve(estimate * numInputs);
+            outputs_.reserve(estimate * numOutputs);
+            reserved = true;
         }
+        inputs_.resizeRows(totalRows);
+        outputs_.resizeRows(totalRows);
         
-        Sample sample;
-        sample.inputs.assign(values.begin(), values.begin() + numInputs);
-        sample.outputs.assign(values.begin() + numInputs, values.end());
+        // Analyser les morceaux en parallèle, chacun dans ses propres lignes
+        chunkValid.assign(numChunks, 0);
+        runChunks(threadPool_, numChunks, [&](size_t c) {
+            chunkValid[c] = parseCSVRows(bounds[c], bounds[c + 1], firstRows[c]);
+        });
         
-        if (validateSample(sample)) {
-            samples_.push_back(sample);
-        } else {
+        if (std::find(chunkValid.begin(), chunkValid.end(), 0) != chunkValid.end()) {
+            // Erreur de format ou valeur invalide
             clear();
             return false;
         }
+        
+        if (atEnd) {
+            break;
+        }
+        
+        pending = static_cast<size_t>(end - complete);
+        std::memmove(buffer.data(), complete, pending);
     }
     
-    file.close();
-    return !samples_.empty();
+    numSamples_ = inputs_.getRows();
+    inputData_ = inputs_.data();
+    outputData_ = outputs_.data();
+    return !isEmpty();
 }
 
-std::vector<double> DatasetManager::parseCSVLine(const std::string& line) {
-    std::vector<double> values;
-    std::stringstream ss(line);
-    std::string item;
+bool DatasetManager::parseCSVLine(const char* begin, const char* end,
+                                  size_t numInputs, size_t numOutputs,
+                                  double* inputs, double* outputs) {
+    size_t numValues = numInputs + numOutputs;
+    size_t count = 0;
     
-    while (std::getline(ss, item, ',')) {
+    while (true) {
+        const char* fieldEnd = findChar(begin, end, ',');
+        
         // Supprimer les espaces
-        item.erase(0, item.find_first_not_of(" \t"));
-        item.erase(item.find_last_not_of(" \t") + 1);
+        const char* first = begin;
+        const char* last = fieldEnd;
+        while (first != last && isBlank(*first)) {
+            ++first;
+        }
+        while (last != first && isBlank(last[-1])) {
+            --last;
+        }
+        if (first != last && *first == '+') {
+            // from_chars refuse le '+' : l'accepter seulement devant un nombre
+            bool numeric = last - first > 1 &&
+                (std::isdigit(static_cast<unsigned char>(first[1])) || first[1] == '.');
+            if (!numeric) {
+                return false;
+            }
+            ++first;
+        }
         
-        if (!item.empty()) {
-            try {
-                double value = std::stod(item);
-                values.push_back(value);
-            } catch (const std::exception&) {
-                // Erreur de conversion
-                return {}; // Retourner un vecteur vide en cas d'erreur
+        if (first != last) {
+            if (count == numValues) {
+                return false;
             }
+            double value;
+            auto [ptr, ec] = std::from_chars(first, last, value);
+            // Refuser les conversions partielles, NaN et Inf
+            if (ec != std::errc() || ptr != last || !std::isfinite(value)) {
+                return false;
+            }
+            if (count < numInputs) {
+                inputs[count] = value;
+            } else {
+                outputs[count - numInputs] = value;
+            }
+            ++count;
         }
+        
+        if (fieldEnd == end) {
+            break;
+        }
+        begin = fieldEnd + 1;
     }
     
-    return values;
+    return count == numValues;
 }
 
-bool DatasetManager::validateSample(const Sample& sample) const {
-    if (sample.inputs.size() != numInputs_ || sample.outputs.size() != numOutputs_) {
-        return false;
+bool DatasetManager::parseCSVRows(const char* begin, const char* end, size_t firstRow) {
+    size_t row = firstRow;
+    while (begin != end) {
+        const char* lineEnd = findChar(begin, end, '\n');
+        if (!isBlankLine(begin, lineEnd)) {
+            if (!parseCSVLine(begin, lineEnd, numInputs_, numOutputs_,
+                              inputs_.row(row), outputs_.row(row))) {
+                return false;
+            }
+            ++row;
+        }
+        begin = nextLine(lineEnd, end);
+    }
+    return true;
+}
+
+DatasetSplit DatasetManager::split(const SplitOptions& options) const {
+    if (isEmpty() || numSamples_ > std::numeric_limits<uint32_t>::max()) {
+        return {};
     }
     
-    // Vérifier qu'il n'y a pas de NaN ou Inf
-    for (double val : sample.inputs) {
-        if (std::isnan(val) || std::isinf(val)) {
-            return false;
+    double trainRatio = std::clamp(options.trainRatio, 0.0, 1.0);
+    double validationRatio = std::clamp(options.validationRatio, 0.0, 1.0 - trainRatio);
+    std::mt19937 generator(options.seed);
+    
+    // Groupes à répartir : une classe par groupe si stratifié, sinon un seul
+    std::vector<std::vector<uint32_t>> groups;
+    if (options.stratify && numOutputs_ > 0) {
+        std::map<double, size_t> groupOfClass;
+        for (uint32_t i = 0; i < numSamples_; ++i) {
+            const double* outputs = outputData_ + static_cast<size_t>(i) * numOutputs_;
+            double label = (numOutputs_ == 1)
+                ? outputs[0]
+                : static_cast<double>(std::max_element(outputs, outputs + numOutputs_) - outputs);
+            auto [it, inserted] = groupOfClass.emplace(label, groups.size());
+            if (inserted) {
+                groups.emplace_back();
+            }
+            groups[it->second].push_back(i);
         }
+    } else {
+        groups.emplace_back(numSamples_);
+        std::iota(groups[0].begin(), groups[0].end(), 0u);
+    }
+    
+    std::vector<uint32_t> train;
+    std::vector<uint32_t> validation;
+    std::vector<uint32_t> test;
+    for (auto& group : groups) {
+        shuffleIndices(group, generator);
+        
+        // Proportions appliquées à chaque classe
+        size_t trainSize = static_cast<size_t>(group.size() * trainRatio);
+        size_t validationSize = static_cast<size_t>(group.size() * validationRatio);
+        auto trainEnd = group.begin() + trainSize;
+        auto validationEnd = trainEnd + validationSize;
+        train.insert(train.end(), group.begin(), trainEnd);
+        validation.insert(validation.end(), trainEnd, validationEnd);
+        test.insert(test.end(), validationEnd, group.end());
     }
     
-    for (double val : sample.outputs) {
-        if (std::isnan(val) || std::isinf(val)) {
+    // Entremêler les classes dans chaque ensemble
+    if (groups.size() > 1) {
+        shuffleIndices(train, generator);
+        shuffleIndices(validation, generator);
+        shuffleIndices(test, generator);
+    }
+    
+    return {DatasetView(*this, std::move(train)),
+            DatasetView(*this, std::move(validation)),
+            DatasetView(*this, std::move(test))};
+}
+
+template <typename T>
+void DatasetManager::packInputs(Span<const uint32_t> indices, BasicMatrix<T>& inputs) const {
+    inputs.resize(indices.size(), numInputs_);
+    
+    for (size_t i = 0; i < indices.size(); ++i) {
+        const double* row = inputData_ + static_cast<size_t>(indices[i]) * numInputs_;
+        std::copy(row, row + numInputs_, inputs.row(i));
+    }
+}
+
+template <typename T>
+void DatasetManager::packOutputs(Span<const uint32_t> indices, BasicMatrix<T>& outputs) const {
+    outputs.resize(indices.size(), numOutputs_);
+    
+    for (size_t i = 0; i < indices.size(); ++i) {
+        const double* row = outputData_ + static_cast<size_t>(indices[i]) * numOutputs_;
+        std::copy(row, row + numOutputs_, outputs.row(i));
+    }
+}
+
+template void DatasetManager::packInputs<float>(Span<const uint32_t>, MatrixF&) const;
+template void DatasetManager::packInputs<double>(Span<const uint32_t>, Matrix&) const;
+template void DatasetManager::packOutputs<float>(Span<const uint32_t>, MatrixF&) const;
+template void DatasetManager::packOutputs<double>(Span<const uint32_t>, Matrix&) const;
+
+bool DatasetManager::loadFromBinary(const std::string& filename, bool verifyChecksum) {
+    clear();
+    
+    auto file = std::make_unique<MappedFile>();
+    if (!file->open(filename) || file->size() < sizeof(BinaryHeader)) {
+        return false;
+    }
+    
+    BinaryHeader header;
+    std::memcpy(&header, file->data(), sizeof(header));
+    if (std::memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0 ||
+        header.version != BINARY_VERSION ||
+        header.dtype != BINARY_DTYPE_FLOAT64) {
+        return false;
+    }
+    
+    // Vérifier que les blocs tiennent dans le fichier (sans débordement)
+    uint64_t fileSize = file->size();
+    uint64_t maxValues = fileSize / sizeof(double);
+    if (header.numSamples > 0 &&
+        (header.numInputs > maxValues / header.numSamples ||
+         header.numOutputs > maxValues / header.numSamples)) {
+        return false;
+    }
+    uint64_t inputBytes = header.numSamples * header.numInputs * sizeof(double);
+    uint64_t outputBytes = header.numSamples * header.numOutputs * sizeof(double);
+    if (header.namesSize > fileSize - sizeof(header) ||
+        header.inputOffset < sizeof(header) + header.namesSize ||
+        header.inputOffset % alignof(double) != 0 ||
+        header.outputOffset % alignof(double) != 0 ||
+        header.inputOffset > fileSize || inputBytes > fileSize - header.inputOffset ||
+        header.outputOffset < header.inputOffset + inputBytes ||
+        header.outputOffset > fileSize || outputBytes > fileSize - header.outputOffset) {
+        return false;
+    }
+    
+    const unsigned char* base = file->data();
+    if (verifyChecksum) {
+        uint64_t checksum = fnv1a(base + header.inputOffset, inputBytes);
+        checksum = fnv1a(base + header.outputOffset, outputBytes, checksum);
+        if (checksum != header.checksum) {
             return false;
         }
     }
     
-    return true;
+    // Noms de colonnes, chacun terminé par '\0'
+    const char* names = reinterpret_cast<const char*>(base + sizeof(header));
+    const char* namesEnd = names + header.namesSize;
+    while (names != namesEnd) {
+        const char* nameEnd = findChar(names, namesEnd, '\0');
+        columnNames_.emplace_back(names, nameEnd);
+        names = (nameEnd == namesEnd) ? namesEnd : nameEnd + 1;
+    }
+    
+    numSamples_ = static_cast<size_t>(header.numSamples);
+    numInputs_ = static_cast<size_t>(header.numInputs);
+    numOutputs_ = static_cast<size_t>(header.numOutputs);
+    inputData_ = reinterpret_cast<const double*>(base + header.inputOffset);
+    outputData_ = reinterpret_cast<const double*>(base + header.outputOffset);
+    mappedFile_ = std::move(file);
+    
+    return !isEmpty();
 }
 
-std::pair<std::vector<DatasetManager::Sample>, std::vector<DatasetManager::Sample>> 
-DatasetManager::splitTrainTest(double trainRatio) {
-    if (samples_.empty()) {
-        return {{}, {}};
+bool DatasetManager::saveToBinary(const std::string& filename) const {
+    if (isEmpty()) {
+        return false;
     }
     
-    // Mélanger les échantillons (optionnel mais recommandé)
-    std::vector<Sample> shuffled = samples_;
-    std::random_device rd;
-    std::mt19937 g(rd());
-    std::shuffle(shuffled.begin(), shuffled.end(), g);
+    std::string names;
+    for (const auto& name : columnNames_) {
+        names += name;
+        names += '\0';
+    }
     
-    size_t trainSize = static_cast<size_t>(samples_.size() * trainRatio);
+    const unsigned char* inputBytes = reinterpret_cast<const unsigned char*>(inputData_);
+    const unsigned char* outputBytes = reinterpret_cast<const unsigned char*>(outputData_);
+    uint64_t inputSize = numSamples_ * numInputs_ * sizeof(double);
+    uint64_t outputSize = numSamples_ * numOutputs_ * sizeof(double);
     
-    std::vector<Sample> trainSamples(shuffled.begin(), shuffled.begin() + trainSize);
-    std::vector<Sample> testSamples(shuffled.begin() + trainSize, shuffled.end());
+    BinaryHeader header = {};
+    std::memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    header.version = BINARY_VERSION;
+    header.dtype = BINARY_DTYPE_FLOAT64;
+    header.numSamples = numSamples_;
+    header.numInputs = numInputs_;
+    header.numOutputs = numOutputs_;
+    header.namesSize = names.size();
+    header.inputOffset = alignUp(sizeof(header) + names.size(), BINARY_ALIGNMENT);
+    header.outputOffset = alignUp(header.inputOffset + inputSize, BINARY_ALIGNMENT);
+    header.checksum = fnv1a(outputBytes, outputSize, fnv1a(inputBytes, inputSize));
     
-    return {trainSamples, testSamples};
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(names.data(), static_cast<std::streamsize>(names.size()));
+    writePadding(file, header.inputOffset - sizeof(header) - names.size());
+    file.write(reinterpret_cast<const char*>(inputBytes), static_cast<std::streamsize>(inputSize));
+    writePadding(file, header.outputOffset - header.inputOffset - inputSize);
+    file.write(reinterpret_cast<const char*>(outputBytes), static_cast<std::streamsize>(outputSize));
+    
+    return file.good();
+}
+
+bool DatasetManager::convertCSVToBinary(const std::string& csvFilename,
+                                        const std::string& binaryFilename,
+                                        size_t numInputs,
+                                        size_t numOutputs,
+                                        bool hasHeader) {
+    DatasetManager dataset;
+    return dataset.loadFromCSV(csvFilename, numInputs, numOutputs, hasHeader) &&
+           dataset.saveToBinary(binaryFilename);
 }
 
 void DatasetManager::clear() {
-    samples_.clear();
+    inputs_ = Matrix();
+    outputs_ = Matrix();
+    mappedFile_.reset();
+    inputData_ = nullptr;
+    outputData_ = nullptr;
+    numSamples_ = 0;
     numInputs_ = 0;
     numOutputs_ = 0;
+    columnNames_.clear();
+}
+
+void DatasetManager::accumulateColumns(const double* values, size_t rows, size_t cols,
+                                       std::vector<double>& min, std::vector<double>& max,
+                                       std::vector<double>& sum) {
+    min.assign(cols, std::numeric_limits<double>::max());
+    max.assign(cols, std::numeric_limits<double>::lowest());
+    sum.assign(cols, 0.0);
+    
+    // Parcours ligne par ligne : accès séquentiels, boucle interne vectorisable
+    for (size_t r = 0; r < rows; ++r) {
+        const double* row = values + r * cols;
+        for (size_t c = 0; c < cols; ++c) {
+            min[c] = std::min(min[c], row[c]);
+            max[c] = std::max(max[c], row[c]);
+            sum[c] += row[c];
+        }
+    }
 }
 
 DatasetManager::Statistics DatasetManager::getStatistics() const {
     Statistics stats;
-    stats.numSamples = samples_.size();
+    stats.numSamples = getNumSamples();
     stats.numInputs = numInputs_;
     stats.numOutputs = numOutputs_;
     
-    if (samples_.empty()) {
+    if (isEmpty()) {
         return stats;
     }
     
-    // Statistiques sur les entrées
-    stats.inputMin.resize(numInputs_, std::numeric_limits<double>::max());
-    stats.inputMax.resize(numInputs_, std::numeric_limits<double>::lowest());
-    stats.inputMean.resize(numInputs_, 0.0);
-    
-    // Statistiques sur les sorties
-    stats.outputMin.resize(numOutputs_, std::numeric_limits<double>::max());
-    stats.outputMax.resize(numOutputs_, std::numeric_limits<double>::lowest());
-    stats.outputMean.resize(numOutputs_, 0.0);
-    
     // Calculer min, max et somme pour les moyennes
-    for (const auto& sample : samples_) {
-        for (size_t i = 0; i < numInputs_; ++i) {
-            stats.inputMin[i] = std::min(stats.inputMin[i], sample.inputs[i]);
-            stats.inputMax[i] = std::max(stats.inputMax[i], sample.inputs[i]);
-            stats.inputMean[i] += sample.inputs[i];
-        }
-        
-        for (size_t i = 0; i < numOutputs_; ++i) {
-            stats.outputMin[i] = std::min(stats.outputMin[i], sample.outputs[i]);
-            stats.outputMax[i] = std::max(stats.outputMax[i], sample.outputs[i]);
-            stats.outputMean[i] += sample.outputs[i];
-        }
-    }
+    accumulateColumns(inputData_, numSamples_, numInputs_,
+                      stats.inputMin, stats.inputMax, stats.inputMean);
+    accumulateColumns(outputData_, numSamples_, numOutputs_,
+                      stats.outputMin, stats.outputMax, stats.outputMean);
     
     // Calculer les moyennes
-    double numSamples = static_cast<double>(samples_.size());
+    double numSamples = static_cast<double>(stats.numSamples);
     for (size_t i = 0; i < numInputs_; ++i) {
         stats.inputMean[i] /= numSamples;
     }
@@ -0,0 +1,112 @@
+#include "dataset/MappedFile.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace NeuroUIT {
+
+MappedFile::MappedFile()
+    : data_(nullptr)
+    , size_(0)
+{
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        return false;
+    }
+
+    // La vue reste valide après la fermeture des handles
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+        return false;
+    }
+
+    data_ = static_cast<const unsigned char*>(view);
+    size_ = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void MappedFile::close() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
+#else
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    size_t fileSize = static_cast<size_t>(info.st_size);
+    void* view = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    // La projection reste valide après la fermeture du descripteur
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+
+    data_ = static_cast<const unsigned char*>(view);
+    size_ = fileSize;
+    return true;
+}
+
+void MappedFile::close() {
+    if (data_) {
+        munmap(const_cast<unsigned char*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
+#endif
+
+} // namespace NeuroUIT
@@ -0,0 +1,239 @@
+#include "dataset/StreamingDataset.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace NeuroUIT {
+
+namespace {
+
+uint32_t resolveSeed(uint32_t seed) {
+    if (seed != 0) {
+        return seed;
+    }
+    std::random_device rd;
+    return rd();
+}
+
+bool isBlankLine(const std::string& line) {
+    return line.find_first_not_of(" \t\r") == std::string::npos;
+}
+
+} // namespace
+
+StreamingDataset::StreamingDataset()
+    : StreamingDataset(Options())
+{
+}
+
+StreamingDataset::StreamingDataset(const Options& options)
+    : options_(options)
+    , source_(Source::None)
+    , numInputs_(0)
+    , numOutputs_(0)
+    , generator_(resolveSeed(options.seed))
+    , hasHeader_(false)
+    , lineNumber_(0)
+    , shardRows_(0)
+    , shardCursor_(0)
+    , binaryCursor_(0)
+    , poolSize_(0)
+    , exhausted_(false)
+    , shuffling_(false)
+{
+    options_.shardSize = std::max<size_t>(1, options_.shardSize);
+    options_.shuffleBufferSize = std::max<size_t>(1, options_.shuffleBufferSize);
+}
+
+bool StreamingDataset::openCSV(const std::string& filename,
+                               size_t numInputs,
+                               size_t numOutputs,
+                               bool hasHeader) {
+    close();
+
+    csvFile_.open(filename, std::ios::binary);
+    if (!csvFile_.is_open()) {
+        return false;
+    }
+
+    source_ = Source::CSV;
+    numInputs_ = numInputs;
+    numOutputs_ = numOutputs;
+    hasHeader_ = hasHeader;
+    shardInputs_.resize(options_.shardSize, numInputs);
+    shardOutputs_.resize(options_.shardSize, numOutputs);
+    rewind();
+    return true;
+}
+
+bool StreamingDataset::openBinary(const std::string& filename) {
+    close();
+
+    // La somme de contrôle obligerait à lire tout le fichier à l'ouverture
+    if (!binary_.loadFromBinary(filename, false)) {
+        return false;
+    }
+
+    source_ = Source::Binary;
+    numInputs_ = binary_.getNumInputs();
+    numOutputs_ = binary_.getNumOutputs();
+    rewind();
+    return true;
+}
+
+void StreamingDataset::close() {
+    csvFile_.close();
+    csvFile_.clear();
+    binary_.clear();
+    source_ = Source::None;
+    numInputs_ = 0;
+    numOutputs_ = 0;
+    shardInputs_ = Matrix();
+    shardOutputs_ = Matrix();
+    poolInputs_ = Matrix();
+    poolOutputs_ = Matrix();
+    shardRows_ = 0;
+    shardCursor_ = 0;
+    binaryCursor_ = 0;
+    poolSize_ = 0;
+    exhausted_ = false;
+}
+
+void StreamingDataset::rewind() {
+    if (source_ == Source::CSV) {
+        csvFile_.clear();
+        csvFile_.seekg(0, std::ios::beg);
+        lineNumber_ = 0;
+        if (hasHeader_ && std::getline(csvFile_, line_)) {
+            ++lineNumber_;
+        }
+    }
+
+    shardRows_ = 0;
+    shardCursor_ = 0;
+    binaryCursor_ = 0;
+    poolSize_ = 0;
+    exhausted_ = (source_ == Source::None);
+
+    shuffling_ = options_.shuffle;
+    if (shuffling_ && poolInputs_.getRows() != options_.shuffleBufferSize) {
+        poolInputs_.resize(options_.shuffleBufferSize, numInputs_);
+        poolOutputs_.resize(options_.shuffleBufferSize, numOutputs_);
+    }
+}
+
+bool StreamingDataset::readCSVShard() {
+    shardRows_ = 0;
+    shardCursor_ = 0;
+
+    while (shardRows_ < options_.shardSize && std::getline(csvFile_, line_)) {
+        ++lineNumber_;
+        if (isBlankLine(line_)) {
+            continue; // Ignorer les lignes vides
+        }
+
+        const char* begin = line_.data();
+        if (!DatasetManager::parseCSVLine(begin, begin + line_.size(), numInputs_, numOutputs_,
+                                          shardInputs_.row(shardRows_),
+                                          shardOutputs_.row(shardRows_))) {
+            throw std::runtime_error("Ligne CSV invalide (ligne " +
+                                     std::to_string(lineNumber_) + ")");
+        }
+        ++shardRows_;
+    }
+
+    return shardRows_ > 0;
+}
+
+bool StreamingDataset::nextSourceRow(const double*& inputs, const double*& outputs) {
+    if (exhausted_) {
+        return false;
+    }
+
+    if (source_ == Source::Binary) {
+        if (binaryCursor_ == binary_.getNumSamples()) {
+            exhausted_ = true;
+            return false;
+        }
+        DatasetManager::Sample sample = binary_.getSample(binaryCursor_++);
+        inputs = sample.inputs.data();
+        outputs = sample.outputs.data();
+        return true;
+    }
+
+    if (shardCursor_ == shardRows_ && !readCSVShard()) {
+        exhausted_ = true;
+        return false;
+    }
+    inputs = shardInputs_.row(shardCursor_);
+    outputs = shardOutputs_.row(shardCursor_);
+    ++shardCursor_;
+    return true;
+}
+
+template <typename T>
+bool StreamingDataset::nextRow(T* inputs, T* outputs) {
+    const double* sourceInputs;
+    const double* sourceOutputs;
+
+    if (!shuffling_) {
+        if (!nextSourceRow(sourceInputs, sourceOutputs)) {
+            return false;
+        }
+        std::copy(sourceInputs, sourceInputs + numInputs_, inputs);
+        std::copy(sourceOutputs, sourceOutputs + numOutputs_, outputs);
+        return true;
+    }
+
+    // Remplir le tampon (en début d'époque)
+    while (poolSize_ < poolInputs_.getRows() && nextSourceRow(sourceInputs, sourceOutputs)) {
+        std::copy(sourceInputs, sourceInputs + numInputs_, poolInputs_.row(poolSize_));
+        std::copy(sourceOutputs, sourceOutputs + numOutputs_, poolOutputs_.row(poolSize_));
+        ++poolSize_;
+    }
+
+    if (poolSize_ == 0) {
+        return false;
+    }
+
+    // Tirer un échantillon du tampon, puis le remplacer par le suivant du fichier
+    std::uniform_int_distribution<size_t> pick(0, poolSize_ - 1);
+    size_t slot = pick(generator_);
+    std::copy(poolInputs_.row(slot), poolInputs_.row(slot) + numInputs_, inputs);
+    std::copy(poolOutputs_.row(slot), poolOutputs_.row(slot) + numOutputs_, outputs);
+
+    if (nextSourceRow(sourceInputs, sourceOutputs)) {
+        std::copy(sourceInputs, sourceInputs + numInputs_, poolInputs_.row(slot));
+        std::copy(sourceOutputs, sourceOutputs + numOutputs_, poolOutputs_.row(slot));
+    } else {
+        // Fichier épuisé : vider le tampon en déplaçant le dernier échantillon
+        --poolSize_;
+        if (slot != poolSize_) {
+            std::copy(poolInputs_.row(poolSize_), poolInputs_.row(poolSize_) + numInputs_,
+                      poolInputs_.row(slot));
+            std::copy(poolOutputs_.row(poolSize_), poolOutputs_.row(poolSize_) + numOutputs_,
+                      poolOutputs_.row(slot));
+        }
+    }
+    return true;
+}
+
+template <typename T>
+size_t StreamingDataset::nextBatch(size_t batchSize, BasicMatrix<T>& inputs,
+                                   BasicMatrix<T>& outputs) {
+    inputs.resize(batchSize, numInputs_);
+    outputs.resize(batchSize, numOutputs_);
+
+    size_t rows = 0;
+    while (rows < batchSize && nextRow(inputs.row(rows), outputs.row(rows))) {
+        ++rows;
+    }
+
+    inputs.resizeRows(rows);
+    outputs.resizeRows(rows);
+    return rows;
+}
+
+template size_t StreamingDataset::nextBatch<float>(size_t, MatrixF&, MatrixF&);
+template size_t StreamingDataset::nextBatch<double>(size_t, Matrix&, Matrix&);
+
+} // namespace NeuroUIT
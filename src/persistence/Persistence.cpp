@@ -6,7 +6,8 @@
 
 namespace NeuroUIT {
 
-bool Persistence::saveNetwork(std::shared_ptr<Network> network, const std::string& filename) {
+template <typename T>
+bool Persistence::saveNetwork(std::shared_ptr<BasicNetwork<T>> network, const std::string& filename) {
     if (!network) {
         return false;
     }
@@ -18,7 +19,10 @@ bool Persistence::saveNetwork(std::shared_ptr<Network> network, const std::strin
     
     // En-tête du fichier
     file << "# NeuroUIT Network File v" << FILE_VERSION << "\n";
-    file << "# Format: Architecture | Activations | Weights\n\n";
+    file << "# Format: Precision | Architecture | Activations | Weights\n\n";
+    
+    // Précision des paramètres
+    file << "PRECISION: " << precisionName(BasicNetwork<T>::precision()) << "\n";
     
     // Architecture
     auto architecture = network->getArchitecture();
@@ -49,7 +53,7 @@ bool Persistence::saveNetwork(std::shared_ptr<Network> network, const std::strin
             file << "NEURON " << neuronIdx << ":";
             const auto& neuronWeights = layerWeights[neuronIdx];
             
-            for (double weight : neuronWeights) {
+            for (T weight : neuronWeights) {
                 file << " " << std::fixed << std::setprecision(10) << weight;
             }
             
@@ -63,7 +67,40 @@ bool Persistence::saveNetwork(std::shared_ptr<Network> network, const std::strin
     return true;
 }
 
+namespace {
+
+/**
+ * @brief Lit la prochaine ligne significative (ni vide, ni commentaire)
+ */
+bool readDataLine(std::ifstream& file, std::string& line) {
+    while (std::getline(file, line)) {
+        if (!line.empty() && line[0] != '#') {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+Precision Persistence::readPrecision(const std::string& filename) {
+    std::ifstream file(filename);
+    std::string line;
+    if (file.is_open() && readDataLine(file, line) &&
+        line.find("PRECISION:") != std::string::npos &&
+        line.find("float") != std::string::npos) {
+        return Precision::Float;
+    }
+    // Version 1 : pas de ligne PRECISION, les poids sont en double
+    return Precision::Double;
+}
+
 std::shared_ptr<Network> Persistence::loadNetwork(const std::string& filename) {
+    return loadNetworkAs<double>(filename);
+}
+
+template <typename T>
+std::shared_ptr<BasicNetwork<T>> Persistence::loadNetworkAs(const std::string& filename) {
     std::ifstream file(filename);
     if (!file.is_open()) {
         return nullptr;
@@ -71,13 +108,20 @@ std::shared_ptr<Network> Persistence::loadNetwork(const std::string& filename) {
     
     std::string line;
     
-    // Lire la version
-    std::getline(file, line);
+    // Ignorer l'en-tête (version, format) puis lire la précision si présente
+    if (!readDataLine(file, line)) {
+        file.close();
+        return nullptr;
+    }
+    if (line.find("PRECISION:") != std::string::npos) {
+        // Les valeurs sont converties vers T quelle que soit la précision du fichier
+        if (!readDataLine(file, line)) {
+            file.close();
+            return nullptr;
+        }
+    }
     
     // Lire l'architecture
-    std::getline(file, line); // Ligne vide
-    std::getline(file, line);
-    
     if (line.find("ARCHITECTURE:") == std::string::npos) {
         file.close();
         return nullptr;
@@ -105,7 +149,7 @@ std::shared_ptr<Network> Persistence::loadNetwork(const std::string& filename) {
     }
     
     // Créer le réseau
-    auto network = std::make_shared<Network>(architecture, activationTypes);
+    auto network = std::make_shared<BasicNetwork<T>>(architecture, activationTypes);
     
     // Lire "WEIGHTS:"
     std::getline(file, line);
@@ -115,7 +159,7 @@ std::shared_ptr<Network> Persistence::loadNetwork(const std::string& filename) {
     }
     
     // Lire les poids couche par couche
-    std::vector<std::vector<std::vector<double>>> allWeights;
+    typename BasicNetwork<T>::WeightTensor allWeights;
     allWeights.resize(architecture.size());
     
     size_t currentLayer = 0;
@@ -149,11 +193,11 @@ std::shared_ptr<Network> Persistence::loadNetwork(const std::string& filename) {
             }
             
             std::istringstream weightStream(line.substr(colonPos + 1));
-            std::vector<double> weights;
+            std::vector<T> weights;
             double weight;
             
             while (weightStream >> weight) {
-                weights.push_back(weight);
+                weights.push_back(static_cast<T>(weight));
             }
             
             if (currentLayer < allWeights.size() && 
@@ -209,6 +253,11 @@ bool Persistence::validateFileFormat(const std::string& filename) {
     return isValid;
 }
 
+template bool Persistence::saveNetwork<float>(std::shared_ptr<BasicNetwork<float>>, const std::string&);
+template bool Persistence::saveNetwork<double>(std::shared_ptr<BasicNetwork<double>>, const std::string&);
+template std::shared_ptr<BasicNetwork<float>> Persistence::loadNetworkAs<float>(const std::string&);
+template std::shared_ptr<BasicNetwork<double>> Persistence::loadNetworkAs<double>(const std::string&);
+
 } // namespace NeuroUIT
 
 
@@ -0,0 +1,179 @@
+#include "training/BatchPrefetcher.h"
+#include <algorithm>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#define NEUROUIT_CPU_PAUSE() _mm_pause()
+#else
+#define NEUROUIT_CPU_PAUSE() ((void)0)
+#endif
+
+namespace NeuroUIT {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Itérations d'attente active avant de céder le cœur
+constexpr size_t SPIN_LIMIT = 64;
+
+// Itérations avant de dormir (attente longue : entraînement en pause...)
+constexpr size_t YIELD_LIMIT = 4096;
+
+/**
+ * @brief Attente active brève, puis yield (indispensable si les deux threads
+ * partagent un même cœur), puis sommeil pour ne pas occuper un cœur à vide
+ */
+inline void backoff(size_t& spins) {
+    if (++spins < SPIN_LIMIT) {
+        NEUROUIT_CPU_PAUSE();
+    } else if (spins < YIELD_LIMIT) {
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+inline double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+template <typename T>
+BasicBatchPrefetcher<T>::BasicBatchPrefetcher(size_t depth)
+    : batches_(std::max<size_t>(depth, 1) + 1)
+    , ready_(batches_.size())
+    , free_(batches_.size())
+    , cancelled_(false)
+    , finished_(false)
+{
+    // Chaque file peut contenir tous les tampons : tryPush n'échoue jamais
+    for (auto& batch : batches_) {
+        free_.tryPush(&batch);
+    }
+}
+
+template <typename T>
+BasicBatchPrefetcher<T>::~BasicBatchPrefetcher() {
+    stop();
+}
+
+template <typename T>
+void BasicBatchPrefetcher<T>::start(size_t numEpochs, EpochStart epochStart, BatchFill fill) {
+    loader_ = std::thread(&BasicBatchPrefetcher::run, this, numEpochs,
+                          std::move(epochStart), std::move(fill));
+}
+
+template <typename T>
+void BasicBatchPrefetcher<T>::run(size_t numEpochs, const EpochStart& epochStart,
+                                  const BatchFill& fill) {
+    try {
+        for (size_t epoch = 0; epoch < numEpochs; ++epoch) {
+            epochStart(epoch);
+
+            while (true) {
+                Batch* batch = waitForFreeBatch();
+                if (!batch) {
+                    finished_.store(true, std::memory_order_release);
+                    return;
+                }
+
+                size_t rows = fill(batch->inputs, batch->targets);
+                if (rows == 0) {
+                    // Lot vide : marqueur de fin d'époque
+                    batch->inputs.resizeRows(0);
+                    batch->targets.resizeRows(0);
+                }
+                ready_.tryPush(batch);
+
+                if (rows == 0) {
+                    break;
+                }
+            }
+        }
+    } catch (...) {
+        loaderError_ = std::current_exception();
+    }
+    finished_.store(true, std::memory_order_release);
+}
+
+template <typename T>
+typename BasicBatchPrefetcher<T>::Batch* BasicBatchPrefetcher<T>::waitForFreeBatch() {
+    Batch* batch;
+    if (free_.tryPop(batch)) {
+        return batch;
+    }
+
+    ++loaderStats_.loaderStalls;
+    Clock::time_point start = Clock::now();
+    size_t spins = 0;
+    while (!free_.tryPop(batch)) {
+        if (cancelled_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        backoff(spins);
+    }
+    loaderStats_.loaderWaitSeconds += secondsSince(start);
+    return batch;
+}
+
+template <typename T>
+const typename BasicBatchPrefetcher<T>::Batch* BasicBatchPrefetcher<T>::acquire() {
+    Batch* batch;
+    if (!ready_.tryPop(batch)) {
+        ++computeStats_.computeStalls;
+        Clock::time_point start = Clock::now();
+        size_t spins = 0;
+        while (!ready_.tryPop(batch)) {
+            if (finished_.load(std::memory_order_acquire)) {
+                // Un dernier lot a pu être publié juste avant la fin du chargeur
+                if (ready_.tryPop(batch)) {
+                    break;
+                }
+                computeStats_.computeWaitSeconds += secondsSince(start);
+                if (loaderError_) {
+                    std::rethrow_exception(loaderError_);
+                }
+                return nullptr;
+            }
+            backoff(spins);
+        }
+        computeStats_.computeWaitSeconds += secondsSince(start);
+    }
+
+    if (batch->inputs.getRows() == 0) {
+        release(batch);
+        return nullptr;
+    }
+    return batch;
+}
+
+template <typename T>
+void BasicBatchPrefetcher<T>::release(const Batch* batch) {
+    free_.tryPush(const_cast<Batch*>(batch));
+}
+
+template <typename T>
+void BasicBatchPrefetcher<T>::stop() {
+    cancelled_.store(true, std::memory_order_release);
+    if (loader_.joinable()) {
+        loader_.join();
+    }
+}
+
+template <typename T>
+PrefetchStats BasicBatchPrefetcher<T>::getStats() const {
+    PrefetchStats stats;
+    stats.computeStalls = computeStats_.computeStalls;
+    stats.computeWaitSeconds = computeStats_.computeWaitSeconds;
+    stats.loaderStalls = loaderStats_.loaderStalls;
+    stats.loaderWaitSeconds = loaderStats_.loaderWaitSeconds;
+    return stats;
+}
+
+template class BasicBatchPrefetcher<float>;
+template class BasicBatchPrefetcher<double>;
+
+} // namespace NeuroUIT
@@ -0,0 +1,108 @@
+#include "training/DataParallel.h"
+#include <algorithm>
+
+namespace NeuroUIT {
+
+template <typename T>
+BasicDataParallel<T>::BasicDataParallel(ThreadPool& pool, const Network& network,
+                                        size_t numThreads, size_t batchCapacity)
+    : pool_(pool)
+    , replicas_(std::max<size_t>(numThreads, 1))
+{
+    size_t shardCapacity = (batchCapacity + replicas_.size() - 1) / replicas_.size();
+    for (auto& replica : replicas_) {
+        replica.workspace = network.createWorkspace(shardCapacity);
+        replica.gradients = network.createGradients();
+    }
+}
+
+template <typename T>
+void BasicDataParallel<T>::run(const Job& job) {
+    // Une tâche par part ; le thread appelant traite la part 0
+    pool_.parallelFor(0, replicas_.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t worker = begin; worker < end; ++worker) {
+            job(worker);
+        }
+    });
+}
+
+template <typename T>
+const BasicGradients<T>& BasicDataParallel<T>::computeGradients(const Network& network,
+                                                                MatrixView inputs,
+                                                                MatrixView targets) {
+    // 1. Gradient de chaque part, dans sa réplique, sur ses lignes du lot
+    Job backward = [&](size_t worker) {
+        Replica& replica = replicas_[worker];
+        replica.gradients.clear();
+        size_t begin = shardBegin(worker, inputs.getRows());
+        size_t end = shardBegin(worker + 1, inputs.getRows());
+        if (end > begin) {
+            network.backwardBatch(inputs.slice(begin, end), targets.slice(begin, end),
+                                  replica.workspace, replica.gradients);
+        }
+    };
+    run(backward);
+
+    // 2. Réduction en arbre dans replicas_[0], chaque tâche sur sa tranche du buffer
+    size_t numReplicas = replicas_.size();
+    size_t bufferSize = replicas_[0].gradients.size();
+    constexpr size_t perLine = kCacheLineSize / sizeof(T);
+    Job reduce = [&](size_t worker) {
+        // Tranches alignées sur les lignes de cache : pas de faux partage
+        size_t numLines = (bufferSize + perLine - 1) / perLine;
+        size_t begin = std::min(bufferSize, worker * numLines / numReplicas * perLine);
+        size_t end = std::min(bufferSize, (worker + 1) * numLines / numReplicas * perLine);
+        for (size_t step = 1; step < numReplicas; step *= 2) {
+            for (size_t r = 0; r + step < numReplicas; r += 2 * step) {
+                T* destination = replicas_[r].gradients.data();
+                const T* source = replicas_[r + step].gradients.data();
+                for (size_t k = begin; k < end; ++k) {
+                    destination[k] += source[k];
+                }
+            }
+        }
+    };
+    run(reduce);
+
+    replicas_[0].gradients.setCount(inputs.getRows());
+    return replicas_[0].gradients;
+}
+
+template <typename T>
+double BasicDataParallel<T>::computeError(const Network& network,
+                                          MatrixView inputs, MatrixView targets) {
+    Job forward = [&](size_t worker) {
+        Replica& replica = replicas_[worker];
+        replica.error = 0.0;
+        size_t begin = shardBegin(worker, inputs.getRows());
+        size_t end = shardBegin(worker + 1, inputs.getRows());
+        if (end == begin) {
+            return;
+        }
+        MatrixView shardTargets = targets.slice(begin, end);
+        MatrixView predictions = network.forwardBatch(inputs.slice(begin, end), replica.workspace);
+        size_t numOutputs = shardTargets.getCols();
+        for (size_t r = 0; r < shardTargets.getRows(); ++r) {
+            const T* prediction = predictions.row(r);
+            const T* target = shardTargets.row(r);
+            double sumSquaredError = 0.0;
+            for (size_t i = 0; i < numOutputs; ++i) {
+                double error = static_cast<double>(prediction[i]) - target[i];
+                sumSquaredError += error * error;
+            }
+            replica.error += sumSquaredError / static_cast<double>(numOutputs);
+        }
+    };
+    run(forward);
+
+    double total = 0.0;
+    for (const auto& replica : replicas_) {
+        total += replica.error;
+    }
+    return inputs.getRows() > 0 ? total / inputs.getRows() : 0.0;
+}
+
+template class BasicDataParallel<float>;
+template class BasicDataParallel<double>;
+
+} // namespace NeuroUIT
@@ -0,0 +1,269 @@
+#include "training/Evaluator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace NeuroUIT {
+
+namespace {
+
+/**
+ * @brief Accumulateurs d'une tranche, fusionnés après les calculs
+ */
+struct ShardTotals {
+    double sumSquaredError = 0.0;
+    double sumAbsoluteError = 0.0;
+    size_t numValues = 0;          // Valeurs cibles vues
+    double meanActual = 0.0;       // Moyenne courante des cibles (Welford)
+    double squaredDeviations = 0.0; // Somme des carrés des écarts à la moyenne
+    size_t correct = 0;            // Classes correctement prédites
+    std::vector<size_t> confusion; // numClasses x numClasses, [prédite][réelle]
+};
+
+/**
+ * @brief Nature des cibles d'une tranche
+ */
+struct TargetScan {
+    bool binary = true;            // Toutes les cibles valent 0 ou 1
+    bool oneHot = true;            // Exactement un 1 par échantillon
+};
+
+/**
+ * @brief Exécute function(s) pour chaque tranche, sur le pool s'il y en a un
+ * @throws La première exception levée par une tranche
+ */
+template <typename Function>
+void runShards(ThreadPool* pool, size_t numShards, const Function& function) {
+    if (!pool) {
+        for (size_t s = 0; s < numShards; ++s) {
+            function(s);
+        }
+        return;
+    }
+    pool->parallelFor(0, numShards, 1, [&](size_t begin, size_t end) {
+        for (size_t s = begin; s < end; ++s) {
+            function(s);
+        }
+    });
+}
+
+template <typename V>
+uint32_t argmax(const V* values, size_t count) {
+    return static_cast<uint32_t>(std::max_element(values, values + count) - values);
+}
+
+/**
+ * @brief Fusionne b dans a (variance par la formule de Chan et al.)
+ */
+void mergeTotals(ShardTotals& a, const ShardTotals& b) {
+    a.sumSquaredError += b.sumSquaredError;
+    a.sumAbsoluteError += b.sumAbsoluteError;
+    if (b.numValues > 0) {
+        size_t numValues = a.numValues + b.numValues;
+        double delta = b.meanActual - a.meanActual;
+        a.meanActual += delta * static_cast<double>(b.numValues) / numValues;
+        a.squaredDeviations += b.squaredDeviations + delta * delta *
+            (static_cast<double>(a.numValues) * b.numValues / numValues);
+        a.numValues = numValues;
+    }
+    a.correct += b.correct;
+    for (size_t i = 0; i < a.confusion.size(); ++i) {
+        a.confusion[i] += b.confusion[i];
+    }
+}
+
+} // namespace
+
+template <typename T>
+EvaluationResults BasicEvaluator<T>::evaluate(const Network& network,
+                                              const DatasetView& testSet) const {
+    EvaluationResults results;
+    if (testSet.empty()) {
+        return results;
+    }
+
+    const DatasetManager& dataset = *testSet.getDataset();
+    Span<const uint32_t> indices = testSet.getIndices();
+    size_t numSamples = testSet.size();
+    size_t numOutputs = testSet.getNumOutputs();
+
+    // Tranches de lots entiers, au plus une par thread
+    size_t numBatches = (numSamples + BATCH_SIZE - 1) / BATCH_SIZE;
+    size_t numShards = std::min(getNumThreads(), numBatches);
+    auto shardBegin = [&](size_t s) {
+        return std::min(numSamples, (s * numBatches / numShards) * BATCH_SIZE);
+    };
+
+    // 1. Nature du problème d'après les cibles
+    std::vector<TargetScan> scans(numShards);
+    runShards(pool_, numShards, [&](size_t s) {
+        TargetScan& scan = scans[s];
+        for (size_t k = shardBegin(s); k < shardBegin(s + 1) && scan.binary; ++k) {
+            size_t ones = 0;
+            for (double output : testSet[k].outputs) {
+                if (output != 0.0 && output != 1.0) {
+                    scan.binary = false;
+                    break;
+                }
+                ones += output == 1.0;
+            }
+            scan.oneHot = scan.oneHot && ones == 1;
+        }
+    });
+
+    bool binary = true;
+    bool oneHot = true;
+    for (const auto& scan : scans) {
+        binary = binary && scan.binary;
+        oneHot = oneHot && scan.oneHot;
+    }
+
+    size_t numClasses = 0;
+    if (binary && numOutputs == 1) {
+        numClasses = 2;                   // Seuil 0.5 sur l'unique sortie
+    } else if (binary && oneHot && numOutputs > 1) {
+        numClasses = numOutputs;          // Argmax sur les sorties
+    }
+    results.isClassification = numClasses > 0;
+    results.numClasses = numClasses;
+
+    // 2. Prédictions et accumulateurs, chaque tranche écrit ses propres lignes
+    results.predictions.resize(numSamples * numOutputs);
+    results.actuals.resize(numSamples * numOutputs);
+    if (results.isClassification) {
+        results.predictedClasses.resize(numSamples);
+        results.actualClasses.resize(numSamples);
+    }
+
+    std::vector<ShardTotals> totals(numShards);
+    runShards(pool_, numShards, [&](size_t s) {
+        ShardTotals& total = totals[s];
+        total.confusion.assign(numClasses * numClasses, 0);
+
+        typename Network::Workspace workspace = network.createWorkspace(BATCH_SIZE);
+        BasicMatrix<T> inputs;
+        size_t shardEnd = shardBegin(s + 1);
+
+        for (size_t begin = shardBegin(s); begin < shardEnd; begin += BATCH_SIZE) {
+            size_t end = std::min(begin + BATCH_SIZE, shardEnd);
+            dataset.packInputs(Span<const uint32_t>(indices.data() + begin, end - begin), inputs);
+            BasicMatrixView<T> outputs = network.forwardBatch(inputs, workspace);
+
+            for (size_t k = begin; k < end; ++k) {
+                const T* prediction = outputs.row(k - begin);
+                Span<const double> actual = testSet[k].outputs;
+                double* predictionsOut = results.predictions.data() + k * numOutputs;
+                double* actualsOut = results.actuals.data() + k * numOutputs;
+
+                for (size_t i = 0; i < numOutputs; ++i) {
+                    double value = static_cast<double>(prediction[i]);
+                    double error = value - actual[i];
+                    predictionsOut[i] = value;
+                    actualsOut[i] = actual[i];
+                    total.sumSquaredError += error * error;
+                    total.sumAbsoluteError += std::abs(error);
+
+                    ++total.numValues;
+                    double delta = actual[i] - total.meanActual;
+                    total.meanActual += delta / static_cast<double>(total.numValues);
+                    total.squaredDeviations += delta * (actual[i] - total.meanActual);
+                }
+
+                if (numClasses > 0) {
+                    uint32_t predicted;
+                    uint32_t expected;
+                    if (numOutputs == 1) {
+                        predicted = predictionsOut[0] >= 0.5 ? 1 : 0;
+                        expected = actual[0] >= 0.5 ? 1 : 0;
+                    } else {
+                        predicted = argmax(prediction, numOutputs);
+                        expected = argmax(actual.data(), numOutputs);
+                    }
+                    results.predictedClasses[k] = predicted;
+                    results.actualClasses[k] = expected;
+                    ++total.confusion[predicted * numClasses + expected];
+                    total.correct += predicted == expected;
+                }
+            }
+        }
+    });
+
+    // 3. Fusion dans l'ordre des tranches et métriques
+    ShardTotals total = std::move(totals[0]);
+    for (size_t s = 1; s < numShards; ++s) {
+        mergeTotals(total, totals[s]);
+    }
+
+    size_t numValues = total.numValues;
+    if (numValues == 0) {
+        return results;
+    }
+    results.mse = total.sumSquaredError / numValues;
+    results.mae = total.sumAbsoluteError / numValues;
+    if (total.squaredDeviations > 0.0) {
+        results.r2 = 1.0 - (total.sumSquaredError / total.squaredDeviations);
+    }
+
+    if (!results.isClassification) {
+        return results;
+    }
+
+    results.confusionMatrix.assign(numClasses, std::vector<int>(numClasses, 0));
+    for (size_t p = 0; p < numClasses; ++p) {
+        for (size_t a = 0; a < numClasses; ++a) {
+            results.confusionMatrix[p][a] = static_cast<int>(total.confusion[p * numClasses + a]);
+        }
+    }
+    results.accuracy = static_cast<double>(total.correct) / numSamples;
+
+    auto ratio = [](size_t numerator, size_t denominator) {
+        return denominator > 0 ? static_cast<double>(numerator) / denominator : 0.0;
+    };
+    auto f1 = [](double precision, double recall) {
+        return precision + recall > 0.0 ? 2.0 * precision * recall / (precision + recall) : 0.0;
+    };
+
+    // Nombre d'échantillons prédits / réels par classe
+    std::vector<size_t> predictedCounts(numClasses, 0);
+    std::vector<size_t> actualCounts(numClasses, 0);
+    for (size_t p = 0; p < numClasses; ++p) {
+        for (size_t a = 0; a < numClasses; ++a) {
+            size_t count = total.confusion[p * numClasses + a];
+            predictedCounts[p] += count;
+            actualCounts[a] += count;
+        }
+    }
+
+    if (numClasses == 2) {
+        // Binaire : métriques de la classe positive (1)
+        size_t tp = total.confusion[1 * numClasses + 1];
+        results.precision = ratio(tp, predictedCounts[1]);
+        results.recall = ratio(tp, actualCounts[1]);
+        results.f1Score = f1(results.precision, results.recall);
+        return results;
+    }
+
+    // Multi-classe : moyenne macro sur les classes prédites ou présentes
+    size_t numSeen = 0;
+    for (size_t c = 0; c < numClasses; ++c) {
+        if (predictedCounts[c] == 0 && actualCounts[c] == 0) {
+            continue;
+        }
+        size_t tp = total.confusion[c * numClasses + c];
+        double precision = ratio(tp, predictedCounts[c]);
+        double recall = ratio(tp, actualCounts[c]);
+        results.precision += precision;
+        results.recall += recall;
+        results.f1Score += f1(precision, recall);
+        ++numSeen;
+    }
+    results.precision /= numSeen;
+    results.recall /= numSeen;
+    results.f1Score /= numSeen;
+
+    return results;
+}
+
+template class BasicEvaluator<float>;
+template class BasicEvaluator<double>;
+
+} // namespace NeuroUIT
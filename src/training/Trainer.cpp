@@ -4,45 +4,167 @@
 #include <numeric>
 #include <cmath>
 #include <stdexcept>
+#include <limits>
+#include <thread>
+#include <exception>
 
 namespace NeuroUIT {
 
-Trainer::Trainer(std::shared_ptr<Network> network)
+template <typename T>
+BasicTrainer<T>::BasicTrainer(std::shared_ptr<Network> network)
     : network_(network)
     , isTraining_(false)
     , shouldStop_(false)
+    , isPaused_(false)
+    , threadPool_(nullptr)
+    , samplesProcessed_(0)
 {
 }
 
-Trainer::TrainingResults Trainer::train(const std::vector<DatasetManager::Sample>& trainSamples,
+template <typename T>
+TrainingResults BasicTrainer<T>::train(const DatasetView& trainSet,
                                         const TrainingParams& params,
                                         ProgressCallback callback) {
     if (!network_) {
         throw std::runtime_error("Aucun réseau assigné au Trainer");
     }
     
-    if (trainSamples.empty()) {
+    if (trainSet.empty()) {
         throw std::invalid_argument("Aucun échantillon d'entraînement fourni");
     }
     
-    isTraining_ = true;
-    shouldStop_ = false;
-    
-    TrainingResults results;
-    results.epochErrors.reserve(params.numEpochs);
+    // Hogwild applique chaque gradient tel quel et assemble les lots sur
+    // chaque thread : refuser plutôt que d'entraîner un autre optimiseur
+    if (params.parallelMode == ParallelMode::Hogwild) {
+        if (params.momentum != 0.0) {
+            throw std::invalid_argument("Le mode Hogwild ne prend pas en charge le momentum");
+        }
+        if (params.prefetchDepth > 0) {
+            throw std::invalid_argument("Le mode Hogwild ne prend pas en charge le préchargement "
+                                        "(prefetchDepth doit valoir 0)");
+        }
+    }
     
-    std::vector<DatasetManager::Sample> currentSamples = trainSamples;
+    // Seul l'ordre de parcours est mélangé : les échantillons ne sont ni copiés ni déplacés
+    const DatasetManager& dataset = *trainSet.getDataset();
+    Span<const uint32_t> indices = trainSet.getIndices();
+    std::vector<uint32_t> order(indices.begin(), indices.end());
     std::random_device rd;
     std::mt19937 generator(rd());
+    size_t position = 0;
     
-    for (size_t epoch = 0; epoch < params.numEpochs && !shouldStop_; ++epoch) {
+    auto epochStart = [&](size_t epoch) {
         // Mélanger les échantillons si demandé
         if (params.shuffle && epoch > 0) {
-            std::shuffle(currentSamples.begin(), currentSamples.end(), generator);
+            std::shuffle(order.begin(), order.end(), generator);
         }
-        
+        position = 0;
+    };
+    
+    auto fill = [&](Matrix& inputs, Matrix& targets) {
+        size_t batchEnd = std::min(position + params.batchSize, order.size());
+        Span<const uint32_t> batch(order.data() + position, batchEnd - position);
+        dataset.packInputs(batch, inputs);
+        dataset.packOutputs(batch, targets);
+        position = batchEnd;
+        return batch.size();
+    };
+    
+    // Au moins un lot complet par thread
+    size_t numThreads = std::min(resolveNumThreads(params),
+                                 order.size() / std::max<size_t>(params.batchSize, 1));
+    if (params.parallelMode == ParallelMode::Hogwild && numThreads > 1) {
+        return runEpochs(params, callback, [&](size_t epoch) {
+            epochStart(epoch);
+            return trainEpochHogwild(dataset, order, params, numThreads);
+        });
+    }
+    
+    return runTraining(params, callback, epochStart, fill);
+}
+
+template <typename T>
+TrainingResults BasicTrainer<T>::train(StreamingDataset& dataset,
+                                        const TrainingParams& params,
+                                        ProgressCallback callback) {
+    if (!network_) {
+        throw std::runtime_error("Aucun réseau assigné au Trainer");
+    }
+    
+    if (!dataset.isOpen()) {
+        throw std::invalid_argument("Aucune source d'entraînement ouverte");
+    }
+    
+    if (params.parallelMode == ParallelMode::Hogwild) {
+        throw std::invalid_argument("Le mode Hogwild nécessite un dataset chargé en mémoire");
+    }
+    
+    dataset.setShuffle(params.shuffle);
+    
+    auto epochStart = [&dataset](size_t) {
+        dataset.rewind();
+    };
+    
+    auto fill = [&dataset, &params](Matrix& inputs, Matrix& targets) {
+        return dataset.nextBatch(params.batchSize, inputs, targets);
+    };
+    
+    return runTraining(params, callback, epochStart, fill);
+}
+
+template <typename T>
+TrainingResults BasicTrainer<T>::runTraining(const TrainingParams& params,
+                                              ProgressCallback callback,
+                                              typename BatchPrefetcher::EpochStart epochStart,
+                                              typename BatchPrefetcher::BatchFill fill) {
+    // Sur un seul cœur, le thread chargeur ne ferait que se disputer le processeur
+    if (params.prefetchDepth == 0 || std::thread::hardware_concurrency() < 2) {
+        return runEpochs(params, callback, [&](size_t epoch) {
+            epochStart(epoch);
+            return trainEpoch(fill, params);
+        });
+    }
+    
+    // Les fonctions capturent l'état de l'appelant : le chargeur est arrêté
+    // (destructeur compris) avant le retour
+    BatchPrefetcher prefetcher(params.prefetchDepth);
+    prefetcher.start(params.numEpochs, std::move(epochStart), std::move(fill));
+    
+    TrainingResults results = runEpochs(params, callback, [&](size_t) {
+        return trainEpoch(prefetcher, params);
+    });
+    
+    prefetcher.stop();
+    results.prefetch = prefetcher.getStats();
+    return results;
+}
+
+template <typename T>
+template <typename EpochFunction>
+TrainingResults BasicTrainer<T>::runEpochs(const TrainingParams& params,
+                                            ProgressCallback callback,
+                                            EpochFunction trainOneEpoch) {
+    isTraining_ = true;
+    shouldStop_ = false;
+    
+    TrainingResults results;
+    results.epochErrors.reserve(params.numEpochs);
+    prepareEvalWorkspace(params.batchSize);
+    
+    // Calcul réparti du gradient, seulement si chaque thread a assez de lignes
+    size_t numThreads = std::min(resolveNumThreads(params), params.batchSize / MIN_ROWS_PER_THREAD);
+    dataParallel_.reset();
+    if (numThreads > 1 && params.parallelMode == ParallelMode::Synchronous) {
+        dataParallel_ = std::make_unique<DataParallel>(*threadPool_, *network_,
+                                                       numThreads, params.batchSize);
+    }
+    
+    samplesProcessed_ = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    
+    for (size_t epoch = 0; epoch < params.numEpochs && waitWhilePaused(); ++epoch) {
         // Entraîner une époque
-        double epochError = trainEpoch(currentSamples, params);
+        double epochError = trainOneEpoch(epoch);
         
         results.epochErrors.push_back(epochError);
         results.epochsCompleted = epoch + 1;
@@ -51,106 +173,281 @@ Trainer::TrainingResults Trainer::train(const std::vector<DatasetManager::Sample
         if (callback) {
             callback(epoch, epochError);
         }
-        
-        // Vérifier si on doit arrêter
-        if (shouldStop_) {
-            results.stopped = true;
-            break;
-        }
     }
     
+    // Arrêt demandé pendant une époque, une pause ou un callback
+    results.stopped = shouldStop_;
     results.finalError = results.epochErrors.empty() ? 0.0 : results.epochErrors.back();
+    dataParallel_.reset();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    if (seconds > 0.0) {
+        results.samplesPerSecond = samplesProcessed_ / seconds;
+    }
+    isPaused_ = false;
     isTraining_ = false;
     
     return results;
 }
 
-double Trainer::trainEpoch(const std::vector<DatasetManager::Sample>& trainSamples,
-                          const TrainingParams& params) {
-    std::vector<double> batchErrors;
-    batchErrors.reserve(trainSamples.size() / params.batchSize + 1);
+template <typename T>
+double BasicTrainer<T>::trainEpoch(const typename BatchPrefetcher::BatchFill& fill,
+                                   const TrainingParams& params) {
+    double errorSum = 0.0;
+    size_t numBatches = 0;
     
-    // Traiter par batches
-    for (size_t i = 0; i < trainSamples.size(); i += params.batchSize) {
-        size_t batchEnd = std::min(i + params.batchSize, trainSamples.size());
-        std::vector<DatasetManager::Sample> batch(
-            trainSamples.begin() + i,
-            trainSamples.begin() + batchEnd
-        );
-        
-        // Traiter le batch
-        processBatch(batch, params);
+    // Assembler puis traiter chaque lot, tour à tour
+    while (fill(batchInputs_, batchTargets_) > 0) {
+        errorSum += trainPackedBatch(batchInputs_, batchTargets_, params);
+        ++numBatches;
         
-        // Calculer l'erreur moyenne du batch
-        double batchError = 0.0;
-        for (const auto& sample : batch) {
-            network_->forward(sample.inputs);
-            double error = Network::computeMeanSquaredError(
-                network_->getLastOutput(),
-                sample.outputs
-            );
-            batchError += error;
+        if (!waitWhilePaused()) {
+            break;
         }
-        batchError /= batch.size();
-        batchErrors.push_back(batchError);
+    }
+    
+    // Retourner l'erreur moyenne de l'époque
+    return numBatches > 0 ? errorSum / numBatches : 0.0;
+}
+
+template <typename T>
+double BasicTrainer<T>::trainEpoch(BatchPrefetcher& prefetcher, const TrainingParams& params) {
+    double errorSum = 0.0;
+    size_t numBatches = 0;
+    
+    // Le lot suivant est assemblé par le chargeur pendant ce calcul
+    while (const auto* batch = prefetcher.acquire()) {
+        errorSum += trainPackedBatch(batch->inputs, batch->targets, params);
+        prefetcher.release(batch);
+        ++numBatches;
         
-        if (shouldStop_) {
+        if (!waitWhilePaused()) {
             break;
         }
     }
     
     // Retourner l'erreur moyenne de l'époque
-    if (batchErrors.empty()) {
-        return 0.0;
+    return numBatches > 0 ? errorSum / numBatches : 0.0;
+}
+
+template <typename T>
+double BasicTrainer<T>::trainEpochHogwild(const DatasetManager& dataset,
+                                          Span<const uint32_t> order,
+                                          const TrainingParams& params,
+                                          size_t numThreads) {
+    // État d'une part, conservé d'un tour à l'autre ; une ligne de cache par
+    // part pour les compteurs, mis à jour une fois par tour
+    struct alignas(kCacheLineSize) Part {
+        size_t position = 0;         // Prochain échantillon de la part dans order
+        size_t end = 0;              // Fin de la part dans order
+        double errorSum = 0.0;       // Somme des erreurs de lot
+        size_t numBatches = 0;
+        size_t numSamples = 0;
+        std::exception_ptr failure;
+        Workspace workspace;         // Buffers propres à la part ; seuls les
+        typename Network::Gradients gradients; // poids du réseau sont partagés
+        Matrix inputs;
+        Matrix targets;
+    };
+    
+    std::vector<Part> parts(numThreads);
+    for (size_t w = 0; w < numThreads; ++w) {
+        parts[w].position = w * order.size() / numThreads;
+        parts[w].end = (w + 1) * order.size() / numThreads;
+        parts[w].workspace = network_->createWorkspace(params.batchSize);
+        parts[w].gradients = network_->createGradients();
+    }
+    
+    // Au plus HOGWILD_ROUND_BATCHES lots, arrêt coopératif entre deux lots
+    auto runRound = [&](Part& part) {
+        try {
+            double errorSum = 0.0;
+            size_t numBatches = 0;
+            size_t numSamples = 0;
+            for (size_t k = 0; k < HOGWILD_ROUND_BATCHES && part.position < part.end && !shouldStop_; ++k) {
+                Span<const uint32_t> batch(order.data() + part.position,
+                                           std::min(params.batchSize, part.end - part.position));
+                dataset.packInputs(batch, part.inputs);
+                dataset.packOutputs(batch, part.targets);
+                
+                part.gradients.clear();
+                network_->backwardBatch(part.inputs, part.targets, part.workspace, part.gradients);
+                network_->applyGradients(part.gradients, params.learningRate);
+                
+                // Erreur du lot après sa mise à jour, comme trainPackedBatch
+                errorSum += computeBatchError(network_->forwardBatch(part.inputs, part.workspace),
+                                              part.targets);
+                ++numBatches;
+                numSamples += batch.size();
+                part.position += batch.size();
+            }
+            part.errorSum += errorSum;
+            part.numBatches += numBatches;
+            part.numSamples += numSamples;
+        } catch (...) {
+            part.failure = std::current_exception();
+            part.position = part.end;
+        }
+    };
+    
+    // La pause est attendue par le thread appelant entre deux tours : les
+    // threads du pool ne sont jamais immobilisés par une tâche en attente
+    auto hasWork = [&] {
+        return std::any_of(parts.begin(), parts.end(),
+                           [](const Part& part) { return part.position < part.end; });
+    };
+    while (hasWork() && waitWhilePaused()) {
+        // Exceptions retenues par part : toutes les parts se terminent avant notifyWeightsChanged
+        threadPool_->parallelFor(0, numThreads, 1, [&](size_t begin, size_t end) {
+            for (size_t w = begin; w < end; ++w) {
+                runRound(parts[w]);
+            }
+        });
     }
-    return std::accumulate(batchErrors.begin(), batchErrors.end(), 0.0) / batchErrors.size();
+    network_->notifyWeightsChanged();
+    
+    double errorSum = 0.0;
+    size_t numBatches = 0;
+    for (const auto& part : parts) {
+        if (part.failure) {
+            std::rethrow_exception(part.failure);
+        }
+        errorSum += part.errorSum;
+        numBatches += part.numBatches;
+        samplesProcessed_ += part.numSamples;
+    }
+    
+    // Moyenne des erreurs de lot, comme trainEpoch
+    return numBatches > 0 ? errorSum / numBatches : 0.0;
 }
 
-void Trainer::processBatch(const std::vector<DatasetManager::Sample>& batchSamples,
-                          const TrainingParams& params) {
-    // Accumuler les gradients pour le batch
-    for (const auto& sample : batchSamples) {
-        // Forward pass
-        network_->forward(sample.inputs);
-        
-        // Backward pass
-        network_->backward(sample.outputs);
+template <typename T>
+double BasicTrainer<T>::trainPackedBatch(const Matrix& inputs, const Matrix& targets,
+                                         const TrainingParams& params) {
+    samplesProcessed_ += inputs.getRows();
+    
+    if (dataParallel_ &&
+        inputs.getRows() >= dataParallel_->getNumThreads() * MIN_ROWS_PER_THREAD) {
+        // Gradient réparti puis réduit, appliqué une seule fois au réseau partagé
+        network_->accumulateGradients(dataParallel_->computeGradients(*network_, inputs, targets));
+        network_->updateWeights(params.learningRate, params.momentum);
+        return dataParallel_->computeError(*network_, inputs, targets);
     }
     
-    // Mise à jour des poids avec la moyenne des gradients du batch
-    double effectiveLearningRate = params.learningRate / batchSamples.size();
-    network_->updateWeights(effectiveLearningRate, params.momentum);
+    // Propagation et rétropropagation du lot complet : le gradient de chaque
+    // échantillon est accumulé, puis la moyenne est appliquée en une seule fois
+    network_->backwardBatch(inputs, targets);
+    network_->updateWeights(params.learningRate, params.momentum);
+    
+    // Calculer l'erreur moyenne du lot après mise à jour (un seul forward pour tout le lot)
+    return computeBatchError(network_->forwardBatch(inputs, evalWorkspace_), targets);
 }
 
-double Trainer::test(const std::vector<DatasetManager::Sample>& testSamples) {
+template <typename T>
+double BasicTrainer<T>::computeBatchError(MatrixView predictions, MatrixView targets) {
+    size_t batchSize = targets.getRows();
+    size_t numOutputs = targets.getCols();
+    if (batchSize == 0) {
+        return 0.0;
+    }
+    
+    double batchError = 0.0;
+    for (size_t j = 0; j < batchSize; ++j) {
+        batchError += computeRowError(predictions.row(j),
+                                      Span<const T>(targets.row(j), numOutputs));
+    }
+    return batchError / batchSize;
+}
+
+template <typename T>
+double BasicTrainer<T>::test(const DatasetView& testSet) {
     if (!network_) {
         throw std::runtime_error("Aucun réseau assigné au Trainer");
     }
     
-    if (testSamples.empty()) {
+    if (testSet.empty()) {
         return 0.0;
     }
     
-    std::vector<double> errors;
-    errors.reserve(testSamples.size());
+    const DatasetManager& dataset = *testSet.getDataset();
+    Span<const uint32_t> indices = testSet.getIndices();
     
-    for (const auto& sample : testSamples) {
-        network_->forward(sample.inputs);
-        double error = Network::computeMeanSquaredError(
-            network_->getLastOutput(),
-            sample.outputs
-        );
-        errors.push_back(error);
+    double totalError = 0.0;
+    prepareEvalWorkspace(EVAL_BATCH_SIZE);
+    
+    // Évaluer par lots de EVAL_BATCH_SIZE échantillons
+    for (size_t begin = 0; begin < testSet.size(); begin += EVAL_BATCH_SIZE) {
+        size_t end = std::min(begin + EVAL_BATCH_SIZE, testSet.size());
+        dataset.packInputs(Span<const uint32_t>(indices.data() + begin, end - begin), batchInputs_);
+        MatrixView predictions = network_->forwardBatch(batchInputs_, evalWorkspace_);
+        
+        for (size_t i = begin; i < end; ++i) {
+            totalError += computeRowError(predictions.row(i - begin), testSet[i].outputs);
+        }
     }
     
     // Retourner l'erreur moyenne
-    return std::accumulate(errors.begin(), errors.end(), 0.0) / errors.size();
+    return totalError / testSet.size();
 }
 
-void Trainer::stop() {
+template <typename T>
+size_t BasicTrainer<T>::resolveNumThreads(const TrainingParams& params) const {
+    size_t available = threadPool_ ? threadPool_->getConcurrency() : 1;
+    if (params.numThreads == 0) {
+        return available;
+    }
+    return std::min(params.numThreads, available);
+}
+
+template <typename T>
+void BasicTrainer<T>::prepareEvalWorkspace(size_t batchCapacity) {
+    if (!evalWorkspace_.matches(network_->getArchitecture())) {
+        evalWorkspace_ = network_->createWorkspace(batchCapacity);
+    } else {
+        evalWorkspace_.reserveBatch(batchCapacity);
+    }
+}
+
+template <typename T>
+template <typename U>
+double BasicTrainer<T>::computeRowError(const T* prediction, Span<const U> targets) {
+    if (targets.empty()) {
+        return 0.0;
+    }
+    
+    double sumSquaredError = 0.0;
+    for (size_t i = 0; i < targets.size(); ++i) {
+        double error = prediction[i] - targets[i];
+        sumSquaredError += error * error;
+    }
+    return sumSquaredError / static_cast<double>(targets.size());
+}
+
+template <typename T>
+void BasicTrainer<T>::stop() {
     shouldStop_ = true;
 }
 
+template <typename T>
+void BasicTrainer<T>::pause() {
+    isPaused_ = true;
+}
+
+template <typename T>
+void BasicTrainer<T>::resume() {
+    isPaused_ = false;
+}
+
+template <typename T>
+bool BasicTrainer<T>::waitWhilePaused() {
+    while (isPaused_ && !shouldStop_) {
+        std::this_thread::sleep_for(PAUSE_POLL_INTERVAL);
+    }
+    return !shouldStop_;
+}
+
+template class BasicTrainer<float>;
+template class BasicTrainer<double>;
+
 } // namespace NeuroUIT
 
 
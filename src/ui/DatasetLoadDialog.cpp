@@ -1,4 +1,5 @@
 #include "ui/DatasetLoadDialog.h"
+#include "controller/Controller.h"
 #include <QVBoxLayout>
 #include <QFormLayout>
 #include <QHBoxLayout>
@@ -24,7 +25,7 @@ DatasetLoadDialog::DatasetLoadDialog(QWidget *parent)
 void DatasetLoadDialog::setupUI() {
     QVBoxLayout* mainLayout = new QVBoxLayout(this);
     
-    QLabel* titleLabel = new QLabel("Chargement d'un dataset CSV");
+    QLabel* titleLabel = new QLabel("Chargement d'un dataset CSV ou binaire (.nuid)");
     titleLabel->setStyleSheet("font-weight: bold; font-size: 14pt;");
     mainLayout->addWidget(titleLabel);
     
@@ -38,7 +39,7 @@ void DatasetLoadDialog::setupUI() {
     fileLayout->addWidget(filePathEdit_);
     fileLayout->addWidget(browseButton_);
     
-    formLayout->addRow("Fichier CSV:", fileLayout);
+    formLayout->addRow("Fichier:", fileLayout);
     
     // Nombre d'entrées et sorties
     numInputsSpinBox_ = new QSpinBox;
@@ -58,6 +59,14 @@ void DatasetLoadDialog::setupUI() {
     hasHeaderCheckBox_->setChecked(false);
     formLayout->addRow("", hasHeaderCheckBox_);
     
+    // Cache binaire (CSV uniquement)
+    useCacheCheckBox_ = new QCheckBox("Accélérer les prochains chargements (cache binaire)");
+    useCacheCheckBox_->setChecked(true);
+    useCacheCheckBox_->setToolTip(QString("Une copie binaire du CSV est conservée dans %1 "
+                                          "(Fichier → Vider le cache des datasets)")
+                                  .arg(QString::fromStdString(Controller::getDatasetCacheDirectory())));
+    formLayout->addRow("", useCacheCheckBox_);
+    
     mainLayout->addLayout(formLayout);
     mainLayout->addStretch();
     
@@ -82,9 +91,9 @@ void DatasetLoadDialog::setupUI() {
 void DatasetLoadDialog::onBrowseFile() {
     QString filename = QFileDialog::getOpenFileName(
         this,
-        "Sélectionner un fichier CSV",
+        "Sélectionner un dataset",
         "",
-        "Fichiers CSV (*.csv);;Tous les fichiers (*.*)"
+        "Datasets (*.csv *.nuid);;Fichiers CSV (*.csv);;Datasets binaires (*.nuid);;Tous les fichiers (*.*)"
     );
     
     if (!filename.isEmpty()) {
@@ -98,6 +107,7 @@ DatasetLoadConfig DatasetLoadDialog::getConfig() const {
     config.numInputs = static_cast<size_t>(numInputsSpinBox_->value());
     config.numOutputs = static_cast<size_t>(numOutputsSpinBox_->value());
     config.hasHeader = hasHeaderCheckBox_->isChecked();
+    config.useCache = useCacheCheckBox_->isChecked();
     
     return config;
 }
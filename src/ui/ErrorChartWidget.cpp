@@ -1,6 +1,8 @@
 #include "ui/ErrorChartWidget.h"
 #include <QPainter>
-#include <QPainterPath>
+#include <QContextMenuEvent>
+#include <QMenu>
+#include <QResizeEvent>
 #include <QFont>
 #include <cmath>
 #include <algorithm>
@@ -8,6 +10,15 @@
 
 ErrorChartWidget::ErrorChartWidget(QWidget *parent)
     : QWidget(parent)
+    , bucketSize_(1)
+    , expectedEpochs_(0)
+    , logScale_(false)
+    , rangeValid_(false)
+    , axisLow_(0.0)
+    , axisHigh_(1.0)
+    , cacheValid_(false)
+    , cachedBuckets_(0)
+    , cachedXSpan_(0)
 {
     setMinimumSize(800, 400);
     setBackgroundRole(QPalette::Base);
@@ -15,50 +26,274 @@ ErrorChartWidget::ErrorChartWidget(QWidget *parent)
 }
 
 void ErrorChartWidget::addDataPoint(size_t epoch, double error) {
-    if (epoch >= epochErrors_.size()) {
-        epochErrors_.resize(epoch + 1);
+    if (!storeValue(epoch, error)) {
+        rebuildBuckets();
     }
-    epochErrors_[epoch] = error;
     update(); // Demander un repaint
 }
 
+void ErrorChartWidget::addDataPoints(size_t firstEpoch, const std::vector<double>& errors) {
+    bool appendedOnly = true;
+    for (size_t i = 0; i < errors.size(); ++i) {
+        appendedOnly &= storeValue(firstEpoch + i, errors[i]);
+    }
+    
+    // Époques déjà affichées modifiées : la série réduite est à refaire
+    if (!appendedOnly) {
+        rebuildBuckets();
+    }
+    update();
+}
+
+void ErrorChartWidget::setEpochRange(size_t numEpochs) {
+    expectedEpochs_ = numEpochs;
+    rebuildBuckets();
+    update();
+}
+
+void ErrorChartWidget::setLogScale(bool enabled) {
+    if (logScale_ == enabled) {
+        return;
+    }
+    logScale_ = enabled;
+    
+    // Les intervalles restent valables (min/max conservés par log10) :
+    // seule l'échelle Y est à recalculer
+    rangeValid_ = false;
+    for (const Bucket& bucket : buckets_) {
+        if (bucket.count > 0) {
+            includeInRange(bucket.min);
+            includeInRange(bucket.max);
+        }
+    }
+    invalidateCache();
+    update();
+}
+
 void ErrorChartWidget::clear() {
     epochErrors_.clear();
+    expectedEpochs_ = 0;
+    rebuildBuckets();
     update();
 }
 
+bool ErrorChartWidget::storeValue(size_t epoch, double error) {
+    if (epoch < epochErrors_.size()) {
+        epochErrors_[epoch] = error;
+        return false;
+    }
+    
+    // Époques non reçues (abandonnées en amont) : trou dans la courbe
+    while (epochErrors_.size() < epoch) {
+        epochErrors_.push_back(std::numeric_limits<double>::quiet_NaN());
+        appendToBuckets(epochErrors_.size() - 1, epochErrors_.back());
+    }
+    epochErrors_.push_back(error);
+    appendToBuckets(epoch, error);
+    return true;
+}
+
+void ErrorChartWidget::appendToBuckets(size_t epoch, double error) {
+    size_t index = epoch / bucketSize_;
+    while (index >= bucketCapacity()) {
+        mergeBuckets();
+        index = epoch / bucketSize_;
+    }
+    if (index >= buckets_.size()) {
+        buckets_.resize(index + 1);
+    }
+    
+    if (std::isnan(error)) {
+        return;
+    }
+    
+    Bucket& bucket = buckets_[index];
+    if (bucket.count == 0) {
+        bucket.first = bucket.min = bucket.max = error;
+    } else {
+        bucket.min = std::min(bucket.min, error);
+        bucket.max = std::max(bucket.max, error);
+    }
+    bucket.last = error;
+    ++bucket.count;
+    
+    includeInRange(error);
+}
+
+void ErrorChartWidget::mergeBuckets() {
+    // Fusionner les intervalles deux à deux : deux fois plus d'époques par intervalle
+    std::vector<Bucket> merged((buckets_.size() + 1) / 2);
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        const Bucket& bucket = buckets_[i];
+        Bucket& target = merged[i / 2];
+        if (bucket.count == 0) {
+            continue;
+        }
+        if (target.count == 0) {
+            target = bucket;
+        } else {
+            target.last = bucket.last;
+            target.min = std::min(target.min, bucket.min);
+            target.max = std::max(target.max, bucket.max);
+            target.count += bucket.count;
+        }
+    }
+    buckets_ = std::move(merged);
+    bucketSize_ *= 2;
+    invalidateCache();
+}
+
+void ErrorChartWidget::rebuildBuckets() {
+    buckets_.clear();
+    rangeValid_ = false;
+    
+    // Avec l'étendue prévue, la taille des intervalles ne changera plus
+    size_t span = std::max(expectedEpochs_, epochErrors_.size());
+    size_t capacity = bucketCapacity();
+    bucketSize_ = std::max<size_t>(1, (span + capacity - 1) / capacity);
+    
+    for (size_t epoch = 0; epoch < epochErrors_.size(); ++epoch) {
+        appendToBuckets(epoch, epochErrors_[epoch]);
+    }
+    invalidateCache();
+}
+
+void ErrorChartWidget::includeInRange(double error) {
+    double value = toAxis(error);
+    
+    if (!rangeValid_) {
+        if (logScale_) {
+            // Échelle en décades entières
+            axisLow_ = std::floor(value);
+            axisHigh_ = std::max(std::ceil(value), axisLow_ + 1.0);
+        } else {
+            axisLow_ = std::min(0.0, value);
+            axisHigh_ = (value > 0.0) ? value * 1.1 : axisLow_ + 1.0;
+        }
+        rangeValid_ = true;
+        invalidateCache();
+        return;
+    }
+    
+    if (value >= axisLow_ && value <= axisHigh_) {
+        return;
+    }
+    
+    // Élargir avec de la marge pour ne pas redessiner à chaque nouvelle valeur
+    if (logScale_) {
+        axisLow_ = std::min(axisLow_, std::floor(value));
+        axisHigh_ = std::max(axisHigh_, std::ceil(value));
+    } else {
+        double margin = 0.1 * std::max(axisHigh_ - axisLow_, std::abs(value));
+        if (value < axisLow_) {
+            axisLow_ = value - margin;
+        } else {
+            axisHigh_ = value + margin;
+        }
+    }
+    invalidateCache();
+}
+
+size_t ErrorChartWidget::bucketCapacity() const {
+    // Un intervalle par pixel de la zone du graphique
+    int chartWidth = width() - LEFT_MARGIN - MARGIN;
+    return std::max<size_t>(MIN_BUCKETS, static_cast<size_t>(std::max(chartWidth, 0)));
+}
+
+size_t ErrorChartWidget::completedBuckets() const {
+    return std::min(epochErrors_.size() / bucketSize_, buckets_.size());
+}
+
+size_t ErrorChartWidget::xSpan() const {
+    return std::max<size_t>(1, std::max(expectedEpochs_, epochErrors_.size()));
+}
+
+double ErrorChartWidget::toAxis(double error) const {
+    return logScale_ ? std::log10(std::max(error, LOG_FLOOR)) : error;
+}
+
+double ErrorChartWidget::xPosition(size_t bucket) const {
+    int chartWidth = width() - LEFT_MARGIN - MARGIN;
+    double epoch = bucket * bucketSize_ + (bucketSize_ - 1) / 2.0;
+    double lastEpoch = static_cast<double>(std::max<size_t>(xSpan() - 1, 1));
+    return LEFT_MARGIN + chartWidth * std::min(epoch, lastEpoch) / lastEpoch;
+}
+
+double ErrorChartWidget::yPosition(double error) const {
+    int chartHeight = height() - MARGIN - BOTTOM_MARGIN;
+    double normalized = (toAxis(error) - axisLow_) / (axisHigh_ - axisLow_);
+    return MARGIN + chartHeight * (1.0 - normalized);
+}
+
+void ErrorChartWidget::resizeEvent(QResizeEvent* event) {
+    QWidget::resizeEvent(event);
+    
+    // La largeur fixe le nombre d'intervalles
+    rebuildBuckets();
+}
+
+void ErrorChartWidget::contextMenuEvent(QContextMenuEvent* event) {
+    QMenu menu(this);
+    QAction* logAction = menu.addAction("Échelle logarithmique");
+    logAction->setCheckable(true);
+    logAction->setChecked(logScale_);
+    
+    if (menu.exec(event->globalPos()) == logAction) {
+        setLogScale(!logScale_);
+    }
+}
+
 void ErrorChartWidget::paintEvent(QPaintEvent* event) {
     QWidget::paintEvent(event);
     
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
     
-    painter.fillRect(rect(), Qt::white);
-    
-    if (epochErrors_.empty()) {
+    if (epochErrors_.empty() || !rangeValid_) {
+        painter.fillRect(rect(), Qt::white);
         painter.drawText(rect(), Qt::AlignCenter, "Aucune donnée à afficher");
         return;
     }
     
-    drawChart(painter);
+    // Redessiner entièrement le pixmap seulement si les échelles ont changé
+    qreal ratio = devicePixelRatioF();
+    QSize pixelSize = size() * ratio;
+    if (!cacheValid_ || cache_.size() != pixelSize || cachedXSpan_ != xSpan()) {
+        cache_ = QPixmap(pixelSize);
+        cache_.setDevicePixelRatio(ratio);
+        cache_.fill(Qt::white);
+        
+        QPainter cachePainter(&cache_);
+        cachePainter.setRenderHint(QPainter::Antialiasing);
+        drawAxes(cachePainter);
+        
+        cachedBuckets_ = 0;
+        cachedXSpan_ = xSpan();
+        cacheValid_ = true;
+    }
+    
+    // Ajouter au pixmap les intervalles complétés depuis le dernier repaint
+    size_t completed = completedBuckets();
+    if (cachedBuckets_ < completed) {
+        QPainter cachePainter(&cache_);
+        cachePainter.setRenderHint(QPainter::Antialiasing);
+        drawBuckets(cachePainter, cachedBuckets_, completed);
+        cachedBuckets_ = completed;
+    }
+    
+    painter.drawPixmap(0, 0, cache_);
+    
+    // L'intervalle en cours de remplissage change encore : dessiné à part
+    drawBuckets(painter, cachedBuckets_, buckets_.size());
 }
 
-void ErrorChartWidget::drawChart(QPainter& painter) {
+void ErrorChartWidget::drawAxes(QPainter& painter) {
     int width = this->width();
     int height = this->height();
     
     int chartWidth = width - LEFT_MARGIN - MARGIN;
     int chartHeight = height - MARGIN - BOTTOM_MARGIN;
     
-    // Trouver min et max pour normaliser
-    auto [minIt, maxIt] = std::minmax_element(epochErrors_.begin(), epochErrors_.end());
-    double minError = *minIt;
-    double maxError = *maxIt;
-    
-    if (maxError == minError) {
-        maxError = minError + 1.0; // Éviter division par zéro
-    }
-    
     // Dessiner les axes
     painter.setPen(QPen(Qt::black, 2));
     
@@ -72,74 +307,80 @@ void ErrorChartWidget::drawChart(QPainter& painter) {
     
     // Labels des axes
     painter.setFont(QFont("Arial", 10));
-    painter.drawText(LEFT_MARGIN - 50, height - BOTTOM_MARGIN + 20, "Erreur");
+    painter.drawText(LEFT_MARGIN - 50, height - BOTTOM_MARGIN + 20,
+                     logScale_ ? "Erreur (log)" : "Erreur");
     painter.drawText(width / 2 - 30, height - 10, "Époque");
     
     // Graduations et labels
-    int numXTicks = std::min(10, static_cast<int>(epochErrors_.size()));
+    size_t span = xSpan();
+    int numXTicks = static_cast<int>(std::min<size_t>(10, span));
     for (int i = 0; i <= numXTicks; ++i) {
         double xPos = LEFT_MARGIN + (chartWidth * i) / numXTicks;
         painter.drawLine(xPos, height - BOTTOM_MARGIN - 5,
                         xPos, height - BOTTOM_MARGIN + 5);
         
-        size_t epoch = (epochErrors_.size() - 1) * i / numXTicks;
+        size_t epoch = (span - 1) * i / numXTicks;
         painter.drawText(xPos - 15, height - BOTTOM_MARGIN + 20,
                         QString::number(epoch));
     }
     
+    if (logScale_) {
+        // Une graduation par décade (au plus une dizaine)
+        int numDecades = static_cast<int>(axisHigh_ - axisLow_);
+        int step = std::max(1, (numDecades + 9) / 10);
+        for (int decade = 0; decade <= numDecades; decade += step) {
+            double exponent = axisLow_ + decade;
+            double yPos = MARGIN + chartHeight * (1.0 - decade / (axisHigh_ - axisLow_));
+            painter.drawLine(LEFT_MARGIN - 5, yPos,
+                            LEFT_MARGIN + 5, yPos);
+            painter.drawText(LEFT_MARGIN - 55, yPos + 5,
+                            QString("1e%1").arg(static_cast<int>(exponent)));
+        }
+        return;
+    }
+    
     int numYTicks = 10;
     for (int i = 0; i <= numYTicks; ++i) {
         double yPos = MARGIN + (chartHeight * (numYTicks - i)) / numYTicks;
         painter.drawLine(LEFT_MARGIN - 5, yPos,
                         LEFT_MARGIN + 5, yPos);
         
-        double error = minError + (maxError - minError) * i / numYTicks;
+        double error = axisLow_ + (axisHigh_ - axisLow_) * i / numYTicks;
         painter.drawText(LEFT_MARGIN - 55, yPos + 5,
                         QString::number(error, 'f', 4));
     }
-    
-    // Dessiner la courbe
-    if (epochErrors_.size() < 2) {
-        return;
-    }
-    
-    QPainterPath path;
-    bool firstPoint = true;
+}
+
+void ErrorChartWidget::drawBuckets(QPainter& painter, size_t begin, size_t end) {
+    int chartWidth = width() - LEFT_MARGIN - MARGIN;
+    double epochSpacing = chartWidth / static_cast<double>(std::max<size_t>(xSpan() - 1, 1));
+    bool drawDots = bucketSize_ == 1 && epochSpacing >= MIN_DOT_SPACING;
     
     painter.setPen(QPen(Qt::blue, 2));
-    painter.setBrush(Qt::NoBrush);
+    painter.setBrush(QBrush(Qt::blue));
     
-    for (size_t i = 0; i < epochErrors_.size(); ++i) {
-        if (epochErrors_[i] == 0.0 && i > 0) {
-            continue; // Ignorer les zéros (époques non encore calculées)
+    for (size_t i = begin; i < end; ++i) {
+        const Bucket& bucket = buckets_[i];
+        if (bucket.count == 0) {
+            continue; // Époques manquantes
         }
         
-        double x = LEFT_MARGIN + (chartWidth * i) / (epochErrors_.size() - 1);
-        double normalizedError = (epochErrors_[i] - minError) / (maxError - minError);
-        double y = MARGIN + chartHeight * (1.0 - normalizedError);
+        double x = xPosition(i);
         
-        if (firstPoint) {
-            path.moveTo(x, y);
-            firstPoint = false;
-        } else {
-            path.lineTo(x, y);
-        }
-    }
-    
-    painter.drawPath(path);
-    
-    // Dessiner les points
-    painter.setBrush(QBrush(Qt::blue));
-    for (size_t i = 0; i < epochErrors_.size(); ++i) {
-        if (epochErrors_[i] == 0.0 && i > 0) {
-            continue;
+        // Relier à l'intervalle précédent
+        if (i > 0 && buckets_[i - 1].count > 0) {
+            painter.drawLine(QPointF(xPosition(i - 1), yPosition(buckets_[i - 1].last)),
+                             QPointF(x, yPosition(bucket.first)));
         }
         
-        double x = LEFT_MARGIN + (chartWidth * i) / (epochErrors_.size() - 1);
-        double normalizedError = (epochErrors_[i] - minError) / (maxError - minError);
-        double y = MARGIN + chartHeight * (1.0 - normalizedError);
+        // Étendue des erreurs de l'intervalle
+        if (bucket.count > 1) {
+            painter.drawLine(QPointF(x, yPosition(bucket.min)),
+                             QPointF(x, yPosition(bucket.max)));
+        }
         
-        painter.drawEllipse(QPointF(x, y), 3, 3);
+        if (drawDots) {
+            painter.drawEllipse(QPointF(x, yPosition(bucket.first)), 3, 3);
+        }
     }
 }
-
@@ -23,6 +23,7 @@
 #include <QPushButton>
 #include <QLabel>
 #include <QTextEdit>
+#include <QPlainTextEdit>
 #include <QTabWidget>
 #include <QSplitter>
 #include <QMessageBox>
@@ -31,6 +32,7 @@
 #include <QDialog>
 #include <QGroupBox>
 #include <QStyle>
+#include <QStringList>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -63,10 +65,13 @@ void MainWindow::setController(std::shared_ptr<NeuroUIT::Controller> controller)
     controller_ = controller;
     if (controller_) {
         // Connecter les signaux du contrôleur
-        connect(controller_.get(), SIGNAL(trainingProgress(size_t, double)),
-                this, SLOT(onTrainingProgress(size_t, double)));
+        // La progression arrive déjà regroupée, une fois par rafraîchissement
+        connect(controller_.get(), &NeuroUIT::Controller::trainingProgress,
+                this, &MainWindow::onTrainingProgress);
         connect(controller_.get(), SIGNAL(trainingFinished()),
                 this, SLOT(onTrainingFinished()));
+        connect(controller_.get(), SIGNAL(trainingFailed(QString)),
+                this, SLOT(onTrainingFailed(QString)));
         connect(controller_.get(), SIGNAL(networkCreated()),
                 this, SLOT(onNetworkCreated()));
         connect(controller_.get(), SIGNAL(datasetLoaded()),
@@ -174,9 +179,9 @@ void MainWindow::setupUI() {
     statisticsWidget_ = new StatisticsWidget;
     resultsDashboardWidget_ = new ResultsDashboardWidget;
     
-    logTextEdit_ = new QTextEdit;
+    logTextEdit_ = new QPlainTextEdit;
     logTextEdit_->setReadOnly(true);
-    // setMaximumBlockCount n'existe pas dans Qt 6, on limite manuellement si nécessaire
+    logTextEdit_->setMaximumBlockCount(LOG_MAX_LINES);
     logTextEdit_->setFont(QFont("Consolas", 9));
     
     // Ajouter les onglets - Dashboard en premier pour être visible
@@ -216,13 +221,16 @@ void MainWindow::setupUI() {
     QHBoxLayout* trainingButtons = new QHBoxLayout;
     btnStartTraining_ = new QPushButton("▶️ Lancer");
     btnStopTraining_ = new QPushButton("⏹️ Arrêter");
+    btnPauseTraining_ = new QPushButton("⏸️ Pause");
     btnTestNetwork_ = new QPushButton("🧪 Tester");
     
     btnStopTraining_->setEnabled(false);
+    btnPauseTraining_->setEnabled(false);
     btnStartTraining_->setStyleSheet("font-weight: bold; background-color: #2196F3; color: white; padding: 8px;");
     btnStopTraining_->setStyleSheet("font-weight: bold; background-color: #f44336; color: white; padding: 8px;");
     
     trainingButtons->addWidget(btnStartTraining_);
+    trainingButtons->addWidget(btnPauseTraining_);
     trainingButtons->addWidget(btnStopTraining_);
     trainingButtons->addWidget(btnTestNetwork_);
     
@@ -231,6 +239,7 @@ void MainWindow::setupUI() {
     // Connecter les boutons
     connect(btnStartTraining_, &QPushButton::clicked, this, &MainWindow::onStartTraining);
     connect(btnStopTraining_, &QPushButton::clicked, this, &MainWindow::onStopTraining);
+    connect(btnPauseTraining_, &QPushButton::clicked, this, &MainWindow::onPauseTraining);
     connect(btnTestNetwork_, &QPushButton::clicked, this, &MainWindow::onTestNetwork);
 }
 
@@ -242,6 +251,7 @@ void MainWindow::setupMenuBar() {
     fileMenu->addAction("&Sauvegarder reseau", QKeySequence::Save, this, &MainWindow::onSaveNetwork);
     fileMenu->addSeparator();
     fileMenu->addAction("&Charger dataset", this, &MainWindow::onLoadDataset);
+    fileMenu->addAction("Vider le cache des datasets", this, &MainWindow::onClearDatasetCache);
     fileMenu->addAction("&Exporter resultats", this, &MainWindow::onExportResults);
     fileMenu->addSeparator();
     fileMenu->addAction("&Quitter", QKeySequence::Quit, this, &QWidget::close);
@@ -317,6 +327,10 @@ void MainWindow::updateUIState() {
     btnLoadDataset_->setEnabled(!isTraining_ && hasNetwork_);
     btnStartTraining_->setEnabled(!isTraining_ && hasNetwork_ && hasDataset_);
     btnStopTraining_->setEnabled(isTraining_);
+    btnPauseTraining_->setEnabled(isTraining_);
+    if (!isTraining_) {
+        btnPauseTraining_->setText("⏸️ Pause");
+    }
     btnTestNetwork_->setEnabled(!isTraining_ && hasNetwork_ && hasDataset_);
 }
 
@@ -379,7 +393,7 @@ void MainWindow::onLoadDataset() {
     if (dialog.exec() == QDialog::Accepted) {
         auto config = dialog.getConfig();
         if (controller_->loadDataset(config.filename, config.numInputs, 
-                                   config.numOutputs, config.hasHeader)) {
+                                   config.numOutputs, config.hasHeader, config.useCache)) {
             statusBar()->showMessage("Dataset chargé avec succès", 3000);
         } else {
             QMessageBox::warning(this, "Erreur", "Impossible de charger le dataset");
@@ -387,6 +401,13 @@ void MainWindow::onLoadDataset() {
     }
 }
 
+void MainWindow::onClearDatasetCache() {
+    if (!controller_) return;
+    
+    size_t removed = controller_->clearDatasetCache();
+    statusBar()->showMessage(QString("Cache des datasets vidé (%1 fichier(s) supprimé(s))").arg(removed), 3000);
+}
+
 void MainWindow::onStartTraining() {
     if (!controller_) return;
     
@@ -401,12 +422,15 @@ void MainWindow::onStartTraining() {
             "Époques: %2\n"
             "Batch size: %3\n"
             "Momentum: %4\n"
-            "Mélanger: %5"
+            "Mélanger: %5\n"
+            "Threads: %6 (%7)"
         ).arg(params.learningRate)
          .arg(params.numEpochs)
          .arg(params.batchSize)
          .arg(params.momentum)
-         .arg(params.shuffle ? "Oui" : "Non");
+         .arg(params.shuffle ? "Oui" : "Non")
+         .arg(params.numThreads)
+         .arg(params.parallelMode == NeuroUIT::ParallelMode::Hogwild ? "Hogwild" : "synchrone");
         configTextEdit_->setPlainText(configText);
         
         isTraining_ = true;
@@ -420,10 +444,17 @@ void MainWindow::onStartTraining() {
         
         // Vider les logs précédents
         errorChartWidget_->clear();
+        errorChartWidget_->setEpochRange(params.numEpochs);
         logTextEdit_->clear();
-        logTextEdit_->insertHtml("<b>🚀 Démarrage de l'entraînement...</b><br>");
+        logTextEdit_->appendHtml("<b>🚀 Démarrage de l'entraînement...</b>");
         
-        controller_->startTraining(params);
+        // L'entraînement s'exécute sur son propre thread : retour immédiat
+        if (!controller_->startTraining(params)) {
+            isTraining_ = false;
+            updateUIState();
+            progressBar_->setVisible(false);
+            statusBar()->showMessage("Impossible de lancer l'entraînement", 3000);
+        }
     }
 }
 
@@ -434,11 +465,25 @@ void MainWindow::onStopTraining() {
     statusBar()->showMessage("Arrêt de l'entraînement demandé...");
 }
 
+void MainWindow::onPauseTraining() {
+    if (!controller_) return;
+    
+    if (controller_->isTrainingPaused()) {
+        controller_->resumeTraining();
+        btnPauseTraining_->setText("⏸️ Pause");
+        statusBar()->showMessage("Entraînement en cours...");
+    } else {
+        controller_->pauseTraining();
+        btnPauseTraining_->setText("▶️ Reprendre");
+        statusBar()->showMessage("Entraînement en pause");
+    }
+}
+
 void MainWindow::onTestNetwork() {
     if (!controller_) return;
     
-    // Obtenir les résultats détaillés
-    auto results = controller_->getDetailedTestResults();
+    // Obtenir les résultats détaillés (mémorisés : le dashboard réutilise la même évaluation)
+    const auto& results = controller_->getDetailedTestResults();
     
     // Mettre à jour le dashboard de résultats (principal - premier onglet)
     resultsDashboardWidget_->updateResults(controller_);
@@ -466,7 +511,10 @@ void MainWindow::onTestNetwork() {
     
     // Mettre à jour la matrice de confusion
     if (!results.confusionMatrix.empty()) {
-        std::vector<QString> labels = {"Classe 0", "Classe 1"};
+        std::vector<QString> labels;
+        for (size_t c = 0; c < results.numClasses; ++c) {
+            labels.push_back(QString("Classe %1").arg(c));
+        }
         confusionMatrixWidget_->updateMatrix(results.confusionMatrix, labels);
     }
     
@@ -481,16 +529,16 @@ void MainWindow::onTestNetwork() {
     QString message = QString("Test terminé - Erreur: %1").arg(results.mse, 0, 'f', 6);
     statusBar()->showMessage(message, 5000);
     
-    logTextEdit_->insertHtml(QString("<b style='color: blue'>[Test] Résultats:</b><br>"));
-    logTextEdit_->insertHtml(QString("  • MSE: <b>%1</b><br>").arg(results.mse, 0, 'f', 6));
-    logTextEdit_->insertHtml(QString("  • MAE: <b>%1</b><br>").arg(results.mae, 0, 'f', 6));
+    logTextEdit_->appendHtml(QString("<b style='color: blue'>[Test] Résultats:</b>"));
+    logTextEdit_->appendHtml(QString("  • MSE: <b>%1</b>").arg(results.mse, 0, 'f', 6));
+    logTextEdit_->appendHtml(QString("  • MAE: <b>%1</b>").arg(results.mae, 0, 'f', 6));
     if (results.isClassification) {
-        logTextEdit_->insertHtml(QString("  • Précision: <b>%1%</b><br>").arg(results.accuracy * 100, 0, 'f', 2));
-        logTextEdit_->insertHtml(QString("  • F1-Score: <b>%1</b><br>").arg(results.f1Score, 0, 'f', 4));
+        logTextEdit_->appendHtml(QString("  • Précision: <b>%1%</b>").arg(results.accuracy * 100, 0, 'f', 2));
+        logTextEdit_->appendHtml(QString("  • F1-Score: <b>%1</b>").arg(results.f1Score, 0, 'f', 4));
     } else {
-        logTextEdit_->insertHtml(QString("  • R²: <b>%1</b><br>").arg(results.r2, 0, 'f', 4));
+        logTextEdit_->appendHtml(QString("  • R²: <b>%1</b>").arg(results.r2, 0, 'f', 4));
     }
-    logTextEdit_->insertHtml("<br>");
+    logTextEdit_->appendPlainText("");
 }
 
 void MainWindow::onExportResults() {
@@ -533,23 +581,28 @@ void MainWindow::onAbout() {
     );
 }
 
-void MainWindow::onTrainingProgress(size_t epoch, double error) {
+void MainWindow::onTrainingProgress(size_t firstEpoch, const std::vector<double>& errors) {
+    // Appelé au plus ~30 fois par seconde (vidage de la file du contrôleur)
+    // avec toutes les époques reçues depuis le dernier rafraîchissement
+    size_t epoch = firstEpoch + errors.size() - 1;
+    double error = errors.back();
+    
     QString message = QString("Époque %1 - Erreur: %2").arg(epoch).arg(error, 0, 'f', 6);
     statusBar()->showMessage(message);
     
-    // Mettre à jour le graphique
-    errorChartWidget_->addDataPoint(epoch, error);
+    // Mettre à jour le graphique (un seul repaint pour tout le paquet)
+    errorChartWidget_->addDataPoints(firstEpoch, errors);
     
-    // Mettre à jour les logs avec couleur
-    QString logEntry = QString("<span style='color: %1'>[Époque %2] Erreur: %3</span><br>")
+    // Une ligne de log par rafraîchissement, avec la dernière époque
+    QString logEntry = QString("<span style='color: %1'>[Époque %2] Erreur: %3</span>")
         .arg(error < 0.1 ? "green" : error < 0.5 ? "orange" : "red")
         .arg(epoch)
         .arg(error, 0, 'f', 6);
-    logTextEdit_->insertHtml(logEntry);
+    logTextEdit_->appendHtml(logEntry);
     
     // Mettre à jour la barre de progression
     if (progressBar_->isVisible() && progressBar_->maximum() > 0) {
-        int progress = static_cast<int>(epoch);
+        int progress = static_cast<int>(epoch + 1);
         if (progress <= progressBar_->maximum()) {
             progressBar_->setValue(progress);
         }
@@ -570,14 +623,35 @@ void MainWindow::onTrainingFinished() {
     progressBar_->setVisible(false);
     
     // Message de succès
-    logTextEdit_->insertHtml("<b style='color: green'>✅ Entraînement terminé avec succès !</b><br>");
+    logTextEdit_->appendHtml("<b style='color: green'>✅ Entraînement terminé avec succès !</b>");
     
     if (controller_) {
         networkVisualizer_->updateNetwork(controller_->getNetwork());
         
+        double samplesPerSecond = controller_->getTrainingResults().samplesPerSecond;
+        if (samplesPerSecond > 0.0) {
+            logTextEdit_->appendHtml(QString("Débit : %1 échantillons/s")
+                                     .arg(samplesPerSecond, 0, 'f', 0));
+        }
+        
+        // Occupation de chaque thread du pool pendant l'entraînement
+        QStringList occupancy;
+        for (const auto& stats : controller_->getThreadPoolStats()) {
+            double total = stats.busySeconds + stats.idleSeconds;
+            if (stats.tasksExecuted > 0 && total > 0.0) {
+                occupancy << QString("%1 %").arg(100.0 * stats.busySeconds / total, 0, 'f', 0);
+            }
+        }
+        if (!occupancy.isEmpty()) {
+            logTextEdit_->appendHtml("Occupation du pool : " + occupancy.join(" / "));
+        }
+        
         // Mettre à jour les métriques d'entraînement
-        auto trainingErrors = controller_->getTrainingErrors();
+        const auto& trainingErrors = controller_->getTrainingErrors();
         if (!trainingErrors.empty()) {
+            // Historique complet (des époques ont pu manquer à l'affichage en direct)
+            errorChartWidget_->addDataPoints(0, trainingErrors);
+            
             MetricsWidget::Metrics metrics;
             metrics.epochsCompleted = trainingErrors.size();
             metrics.finalError = trainingErrors.back();
@@ -590,6 +664,16 @@ void MainWindow::onTrainingFinished() {
     showNotification("Entraînement terminé avec succès !", false);
 }
 
+void MainWindow::onTrainingFailed(const QString& message) {
+    isTraining_ = false;
+    updateUIState();
+    statusBar()->showMessage("❌ Échec de l'entraînement", 3000);
+    progressBar_->setVisible(false);
+    
+    logTextEdit_->appendHtml(QString("<b style='color: red'>❌ %1</b>").arg(message.toHtmlEscaped()));
+    showNotification("Échec de l'entraînement : " + message, true);
+}
+
 void MainWindow::onNetworkCreated() {
     hasNetwork_ = true;
     updateUIState();
@@ -631,7 +715,7 @@ void MainWindow::onDatasetLoaded() {
         statisticsWidget_->updateStatistics(stats);
         
         // Mettre à jour la matrice de corrélation
-        auto correlationMatrix = controller_->getCorrelationMatrix();
+        const auto& correlationMatrix = controller_->getCorrelationMatrix();
         if (!correlationMatrix.empty()) {
             std::vector<QString> labels;
             size_t numVars = correlationMatrix.size();
@@ -2,9 +2,9 @@
 #include "controller/Controller.h"
 #include "core/Network.h"
 #include "core/ActivationFunction.h"
+#include "ui/TestResultsTableModel.h"
 #include <QFrame>
 #include <QHeaderView>
-#include <QTableWidgetItem>
 #include <QBrush>
 #include <QColor>
 #include <QHeaderView>
@@ -79,16 +79,16 @@ void ResultsDashboardWidget::setupUI() {
     
     // Style pour les tableaux
     QString tableStyle =
-        "QTableWidget { "
+        "QTableView { "
         "border: 1px solid #e0e0e0; "
         "border-radius: 5px; "
         "background-color: #ffffff; "
         "gridline-color: #f0f0f0; "
         "}"
-        "QTableWidget::item { "
+        "QTableView::item { "
         "padding: 5px; "
         "}"
-        "QTableWidget::item:selected { "
+        "QTableView::item:selected { "
         "background-color: #E3F2FD; "
         "color: #1976D2; "
         "}"
@@ -243,9 +243,13 @@ void ResultsDashboardWidget::setupClassificationResultsSection() {
     classificationResultsGroup_ = new QGroupBox("Resultats de Classification");
     QVBoxLayout* layout = new QVBoxLayout(classificationResultsGroup_);
     
-    classificationTable_ = new QTableWidget;
-    classificationTable_->setColumnCount(4);
-    classificationTable_->setHorizontalHeaderLabels({"Echantillon", "Valeur Reelle", "Prediction", "Statut"});
+    // Modèle paresseux : seules les lignes visibles sont calculées
+    classificationModel_ = new TestResultsTableModel(TestResultsTableModel::Mode::Classification, this);
+    classificationTable_ = new QTableView;
+    classificationTable_->setModel(classificationModel_);
+    classificationTable_->setSortingEnabled(true);
+    classificationTable_->verticalHeader()->setVisible(false);
+    classificationTable_->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
     classificationTable_->horizontalHeader()->setStretchLastSection(true);
     classificationTable_->setEditTriggers(QAbstractItemView::NoEditTriggers);
     classificationTable_->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -260,9 +264,13 @@ void ResultsDashboardWidget::setupRegressionResultsSection() {
     regressionResultsGroup_ = new QGroupBox("Resultats de Regression");
     QVBoxLayout* layout = new QVBoxLayout(regressionResultsGroup_);
     
-    regressionTable_ = new QTableWidget;
-    regressionTable_->setColumnCount(5);
-    regressionTable_->setHorizontalHeaderLabels({"Echantillon", "Valeur Reelle", "Prediction", "Erreur", "Erreur %"});
+    // Modèle paresseux : seules les lignes visibles sont calculées
+    regressionModel_ = new TestResultsTableModel(TestResultsTableModel::Mode::Regression, this);
+    regressionTable_ = new QTableView;
+    regressionTable_->setModel(regressionModel_);
+    regressionTable_->setSortingEnabled(true);
+    regressionTable_->verticalHeader()->setVisible(false);
+    regressionTable_->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
     regressionTable_->horizontalHeader()->setStretchLastSection(true);
     regressionTable_->setEditTriggers(QAbstractItemView::NoEditTriggers);
     regressionTable_->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -360,7 +368,7 @@ void ResultsDashboardWidget::updateResults(std::shared_ptr<NeuroUIT::Controller>
     lblActivationFunctions_->setText(activationsText);
     
     // Résultats de test
-    auto testResults = controller->getDetailedTestResults();
+    const auto& testResults = controller->getDetailedTestResults();
     
     if (testResults.isClassification) {
         classificationResultsGroup_->setVisible(true);
@@ -378,28 +386,10 @@ void ResultsDashboardWidget::updateResults(std::shared_ptr<NeuroUIT::Controller>
         
         lblF1Score_->setText(QString("%1").arg(testResults.f1Score, 0, 'f', 4));
         
-        // Remplir le tableau de classification
-        size_t numSamples = std::min(testResults.predictions.size(), testResults.actuals.size());
-        classificationTable_->setRowCount(static_cast<int>(numSamples));
-        
-        int correctCount = 0;
-        for (size_t i = 0; i < numSamples; ++i) {
-            int predicted = (testResults.predictions[i] >= 0.5) ? 1 : 0;
-            int actual = (testResults.actuals[i] >= 0.5) ? 1 : 0;
-            bool isCorrect = (predicted == actual);
-            if (isCorrect) correctCount++;
-            
-            classificationTable_->setItem(static_cast<int>(i), 0, 
-                new QTableWidgetItem(QString("Echantillon %1").arg(i + 1)));
-            classificationTable_->setItem(static_cast<int>(i), 1, 
-                new QTableWidgetItem(QString::number(actual)));
-            classificationTable_->setItem(static_cast<int>(i), 2, 
-                new QTableWidgetItem(QString::number(predicted)));
-            
-            QTableWidgetItem* statusItem = new QTableWidgetItem(isCorrect ? "Correct" : "Incorrect");
-            statusItem->setForeground(isCorrect ? QBrush(QColor(0, 150, 0)) : QBrush(QColor(200, 0, 0)));
-            classificationTable_->setItem(static_cast<int>(i), 3, statusItem);
-        }
+        // Le modèle garde sa copie : les résultats restent mémorisés par le contrôleur
+        classificationModel_->setResults(
+            std::vector<double>(testResults.predictedClasses.begin(), testResults.predictedClasses.end()),
+            std::vector<double>(testResults.actualClasses.begin(), testResults.actualClasses.end()));
         classificationTable_->resizeColumnsToContents();
         
     } else {
@@ -411,26 +401,9 @@ void ResultsDashboardWidget::updateResults(std::shared_ptr<NeuroUIT::Controller>
         lblMAE_->setText(QString("%1").arg(testResults.mae, 0, 'f', 6));
         lblR2_->setText(QString("%1").arg(testResults.r2, 0, 'f', 4));
         
-        // Remplir le tableau de régression
-        size_t numSamples = std::min(testResults.predictions.size(), testResults.actuals.size());
-        regressionTable_->setRowCount(static_cast<int>(numSamples));
-        
-        for (size_t i = 0; i < numSamples; ++i) {
-            double error = testResults.predictions[i] - testResults.actuals[i];
-            double errorPercent = testResults.actuals[i] != 0.0 ? 
-                (error / testResults.actuals[i]) * 100.0 : 0.0;
-            
-            regressionTable_->setItem(static_cast<int>(i), 0, 
-                new QTableWidgetItem(QString("Echantillon %1").arg(i + 1)));
-            regressionTable_->setItem(static_cast<int>(i), 1, 
-                new QTableWidgetItem(QString::number(testResults.actuals[i], 'f', 4)));
-            regressionTable_->setItem(static_cast<int>(i), 2, 
-                new QTableWidgetItem(QString::number(testResults.predictions[i], 'f', 4)));
-            regressionTable_->setItem(static_cast<int>(i), 3, 
-                new QTableWidgetItem(QString::number(error, 'f', 4)));
-            regressionTable_->setItem(static_cast<int>(i), 4, 
-                new QTableWidgetItem(QString("%1%").arg(errorPercent, 0, 'f', 2)));
-        }
+        // Le modèle garde sa copie : les résultats restent mémorisés par le contrôleur
+        regressionModel_->setResults(testResults.predictions,
+                                     testResults.actuals);
         regressionTable_->resizeColumnsToContents();
     }
     
@@ -464,8 +437,8 @@ void ResultsDashboardWidget::clear() {
     precisionBar_->setValue(0);
     recallBar_->setValue(0);
     
-    classificationTable_->setRowCount(0);
-    regressionTable_->setRowCount(0);
+    classificationModel_->clear();
+    regressionModel_->clear();
     
     lblEpochs_->setText("-");
     lblFinalError_->setText("-");
@@ -0,0 +1,164 @@
+#include "ui/TestResultsTableModel.h"
+#include <QBrush>
+#include <QColor>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <numeric>
+
+namespace {
+
+// En classification, les tableaux contiennent des indices de classe
+long long classIndex(double value) {
+    return std::llround(value);
+}
+
+} // namespace
+
+TestResultsTableModel::TestResultsTableModel(Mode mode, QObject *parent)
+    : QAbstractTableModel(parent)
+    , mode_(mode)
+    , sortColumn_(0)
+    , sortOrder_(Qt::AscendingOrder)
+{
+}
+
+void TestResultsTableModel::setResults(std::vector<double> predictions, std::vector<double> actuals) {
+    beginResetModel();
+    size_t numSamples = std::min(predictions.size(), actuals.size());
+    predictions_ = std::move(predictions);
+    actuals_ = std::move(actuals);
+    predictions_.resize(numSamples);
+    actuals_.resize(numSamples);
+    buildOrder();
+    endResetModel();
+}
+
+void TestResultsTableModel::clear() {
+    setResults({}, {});
+}
+
+int TestResultsTableModel::rowCount(const QModelIndex& parent) const {
+    if (parent.isValid()) {
+        return 0;
+    }
+    return static_cast<int>(std::min<size_t>(predictions_.size(), INT_MAX));
+}
+
+int TestResultsTableModel::columnCount(const QModelIndex& parent) const {
+    if (parent.isValid()) {
+        return 0;
+    }
+    return mode_ == Mode::Classification ? 4 : 5;
+}
+
+QVariant TestResultsTableModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= rowCount()) {
+        return QVariant();
+    }
+    
+    size_t sample = sampleAt(index.row());
+    double actual = actuals_[sample];
+    double prediction = predictions_[sample];
+    
+    if (mode_ == Mode::Classification) {
+        bool isCorrect = classIndex(prediction) == classIndex(actual);
+        
+        if (role == Qt::ForegroundRole && index.column() == 3) {
+            return isCorrect ? QBrush(QColor(0, 150, 0)) : QBrush(QColor(200, 0, 0));
+        }
+        if (role != Qt::DisplayRole) {
+            return QVariant();
+        }
+        
+        switch (index.column()) {
+            case 0: return QString("Echantillon %1").arg(sample + 1);
+            case 1: return QString::number(classIndex(actual));
+            case 2: return QString::number(classIndex(prediction));
+            case 3: return isCorrect ? "Correct" : "Incorrect";
+        }
+        return QVariant();
+    }
+    
+    if (role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    
+    double error = prediction - actual;
+    switch (index.column()) {
+        case 0: return QString("Echantillon %1").arg(sample + 1);
+        case 1: return QString::number(actual, 'f', 4);
+        case 2: return QString::number(prediction, 'f', 4);
+        case 3: return QString::number(error, 'f', 4);
+        case 4: {
+            double errorPercent = actual != 0.0 ? (error / actual) * 100.0 : 0.0;
+            return QString("%1%").arg(errorPercent, 0, 'f', 2);
+        }
+    }
+    return QVariant();
+}
+
+QVariant TestResultsTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if (role != Qt::DisplayRole || orientation != Qt::Horizontal) {
+        return QVariant();
+    }
+    
+    switch (section) {
+        case 0: return "Echantillon";
+        case 1: return "Valeur Reelle";
+        case 2: return "Prediction";
+        case 3: return mode_ == Mode::Classification ? "Statut" : "Erreur";
+        case 4: return "Erreur %";
+    }
+    return QVariant();
+}
+
+double TestResultsTableModel::sortKey(size_t sample, int column) const {
+    double actual = actuals_[sample];
+    double prediction = predictions_[sample];
+    
+    switch (column) {
+        case 1:
+            return actual;
+        case 2:
+            return prediction;
+        case 4:
+            return actual != 0.0 ? std::abs((prediction - actual) / actual) : 0.0;
+        case 3:
+            // Erreur en régression, correct/incorrect pour le statut
+            return std::abs(prediction - actual);
+    }
+    return static_cast<double>(sample);
+}
+
+void TestResultsTableModel::sort(int column, Qt::SortOrder order) {
+    beginResetModel();
+    sortColumn_ = column;
+    sortOrder_ = order;
+    buildOrder();
+    endResetModel();
+}
+
+void TestResultsTableModel::buildOrder() {
+    if (sortColumn_ <= 0 && sortOrder_ == Qt::AscendingOrder) {
+        // Ordre des échantillons : aucune permutation
+        order_.clear();
+        return;
+    }
+    
+    // Clés calculées une seule fois, pas à chaque comparaison
+    std::vector<double> keys(predictions_.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = sortKey(i, sortColumn_);
+    }
+    
+    order_.resize(predictions_.size());
+    std::iota(order_.begin(), order_.end(), 0u);
+    if (sortOrder_ == Qt::AscendingOrder) {
+        std::stable_sort(order_.begin(), order_.end(),
+                         [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+    } else {
+        std::stable_sort(order_.begin(), order_.end(),
+                         [&](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+    }
+}
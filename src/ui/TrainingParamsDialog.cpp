@@ -6,8 +6,11 @@
 #include <QDoubleSpinBox>
 #include <QSpinBox>
 #include <QCheckBox>
+#include <QComboBox>
 #include <QLabel>
 #include <QPushButton>
+#include <algorithm>
+#include <thread>
 
 namespace NeuroUIT {
 
@@ -62,6 +65,34 @@ void TrainingParamsDialog::setupUI() {
     momentumSpinBox_->setValue(0.0);
     formLayout->addRow("Momentum:", momentumSpinBox_);
     
+    // Threads de calcul du gradient
+    numThreadsSpinBox_ = new QSpinBox;
+    numThreadsSpinBox_->setMinimum(1);
+    numThreadsSpinBox_->setMaximum(static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
+    numThreadsSpinBox_->setValue(1);
+    numThreadsSpinBox_->setToolTip(QString("Chaque lot est réparti entre les threads "
+                                           "(au moins %1 échantillons par thread)")
+                                   .arg(Trainer::MIN_ROWS_PER_THREAD));
+    formLayout->addRow("Threads de calcul:", numThreadsSpinBox_);
+    
+    // Répartition entre threads
+    parallelModeComboBox_ = new QComboBox;
+    parallelModeComboBox_->addItem("Synchrone (lots partagés)");
+    parallelModeComboBox_->addItem("Asynchrone (Hogwild, sans momentum)");
+    parallelModeComboBox_->setToolTip("Hogwild : chaque thread met à jour les poids sans attendre "
+                                      "les autres ; plus rapide quand la synchronisation domine");
+    formLayout->addRow("Mode parallèle:", parallelModeComboBox_);
+    
+    // Hogwild applique chaque gradient sans momentum
+    connect(parallelModeComboBox_, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, [this](int index) {
+        bool hogwild = index == 1;
+        if (hogwild) {
+            momentumSpinBox_->setValue(0.0);
+        }
+        momentumSpinBox_->setEnabled(!hogwild);
+    });
+    
     // Mélanger
     shuffleCheckBox_ = new QCheckBox("Mélanger les échantillons à chaque époque");
     shuffleCheckBox_->setChecked(true);
@@ -93,6 +124,14 @@ Trainer::TrainingParams TrainingParamsDialog::getParams() const {
     params.numEpochs = static_cast<size_t>(numEpochsSpinBox_->value());
     params.batchSize = static_cast<size_t>(batchSizeSpinBox_->value());
     params.momentum = momentumSpinBox_->value();
+    params.numThreads = static_cast<size_t>(numThreadsSpinBox_->value());
+    params.parallelMode = parallelModeComboBox_->currentIndex() == 1
+                        ? ParallelMode::Hogwild : ParallelMode::Synchronous;
+    if (params.parallelMode == ParallelMode::Hogwild) {
+        // Chaque thread Hogwild assemble ses propres lots
+        params.momentum = 0.0;
+        params.prefetchDepth = 0;
+    }
     params.shuffle = shuffleCheckBox_->isChecked();
     
     return params;
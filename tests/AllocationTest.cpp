@@ -0,0 +1,143 @@
+/**
+ * @brief Vérifie que forward/backward/predict n'allouent rien en régime établi
+ *
+ * operator new est remplacé par une version qui compte les allocations
+ * pendant les sections mesurées. Chaque cas fait d'abord un appel de
+ * préchauffage (dimensionnement des buffers), puis compte les allocations
+ * d'une série d'appels identiques : le compteur doit rester à zéro.
+ */
+
+#include "core/Network.h"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace {
+
+size_t allocationCount = 0;
+bool countingAllocations = false;
+
+void* allocate(size_t size, size_t alignment) {
+    if (countingAllocations) {
+        ++allocationCount;
+    }
+    size = size ? size : 1;
+#if defined(_WIN32)
+    void* pointer = _aligned_malloc(size, alignment);
+#else
+    void* pointer = nullptr;
+    if (posix_memalign(&pointer, alignment < sizeof(void*) ? sizeof(void*) : alignment, size) != 0) {
+        pointer = nullptr;
+    }
+#endif
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void deallocate(void* pointer) noexcept {
+#if defined(_WIN32)
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+} // namespace
+
+void* operator new(size_t size) { return allocate(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t alignment) {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+void operator delete(void* pointer) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, size_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { deallocate(pointer); }
+
+namespace {
+
+using namespace NeuroUIT;
+
+constexpr size_t ITERATIONS = 100;
+constexpr size_t BATCH_SIZE = 32;
+
+int failures = 0;
+
+/**
+ * @brief Compte les allocations de ITERATIONS appels à step, après un appel de préchauffage
+ */
+template <typename Step>
+void expectNoAllocation(const char* name, const Step& step) {
+    step();
+
+    allocationCount = 0;
+    countingAllocations = true;
+    for (size_t i = 0; i < ITERATIONS; ++i) {
+        step();
+    }
+    countingAllocations = false;
+
+    if (allocationCount == 0) {
+        std::printf("PASS  %s\n", name);
+    } else {
+        std::printf("FAIL  %s : %zu allocations pour %zu appels\n", name, allocationCount, ITERATIONS);
+        ++failures;
+    }
+}
+
+template <typename T>
+void testNetwork(const char* type) {
+    using Network = BasicNetwork<T>;
+    using Matrix = BasicMatrix<T>;
+
+    Network network({4, 16, 8, 3},
+                    {ActivationType::Tanh, ActivationType::ReLU, ActivationType::Sigmoid});
+    std::vector<T> input = {T(0.1), T(0.2), T(0.3), T(0.4)};
+    std::vector<T> target = {T(0), T(1), T(0)};
+    Matrix inputs(BATCH_SIZE, 4, T(0.5));
+    Matrix targets(BATCH_SIZE, 3, T(0.2));
+    typename Network::Workspace workspace = network.createWorkspace(BATCH_SIZE);
+    typename Network::Gradients gradients = network.createGradients();
+
+    std::printf("[%s]\n", type);
+
+    expectNoAllocation("forward + backward + updateWeights", [&] {
+        network.forward(Span<const T>(input));
+        network.backward(Span<const T>(target));
+        network.updateWeights(0.1, 0.9);
+    });
+
+    expectNoAllocation("predict", [&] {
+        network.predict(Span<const T>(input), workspace);
+    });
+
+    expectNoAllocation("forwardBatch", [&] {
+        network.forwardBatch(inputs, workspace);
+    });
+
+    expectNoAllocation("backwardBatch + updateWeights", [&] {
+        network.backwardBatch(inputs, targets);
+        network.updateWeights(0.1, 0.9);
+    });
+
+    expectNoAllocation("backwardBatch (workspace, gradients) + applyGradients", [&] {
+        gradients.clear();
+        network.backwardBatch(inputs, targets, workspace, gradients);
+        network.applyGradients(gradients, 0.1);
+    });
+}
+
+} // namespace
+
+int main() {
+    testNetwork<double>("double");
+    testNetwork<float>("float");
+
+    if (failures > 0) {
+        std::printf("%d cas en échec\n", failures);
+        return 1;
+    }
+    return 0;
+}
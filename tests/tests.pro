@@ -0,0 +1,25 @@
+# Tests (console, sans Qt)
+# Compilation et exécution : qmake tests/tests.pro && make check
+
+QT =
+CONFIG += console c++17 testcase
+CONFIG -= qt app_bundle
+
+TARGET = NeuroUIT_tests
+TEMPLATE = app
+
+INCLUDEPATH += $$PWD/../include
+
+SOURCES += \
+    AllocationTest.cpp \
+    ../src/core/Neuron.cpp \
+    ../src/core/Layer.cpp \
+    ../src/core/Network.cpp \
+    ../src/core/Workspace.cpp \
+    ../src/core/ActivationFunction.cpp \
+    ../src/core/ActivationKernels.cpp \
+    ../src/core/Kernels.cpp \
+    ../src/core/LinearAlgebra.cpp
+
+DESTDIR = $$PWD/../bin
+OBJECTS_DIR = $$PWD/../build/tests/obj